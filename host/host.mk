@@ -0,0 +1,86 @@
+# CanalUx - Host (native) build of the simulation
+# Included from the main Makefile when a host target is requested, so the
+# Tyra toolchain is not needed. Tyra types come from host/inc/tyra.
+#
+#   make host                          Build bin/host/canalux_sim
+#   make run-host HOST_FRAMES=N HOST_SEED=S HOST_ARGS="--level 2"
+#   make bench                         Build bin/host/canalux_bench
+#   make run-bench BENCH_ARGS="--filter collision"
+#   make clean-host
+
+HOST_CXX       ?= g++
+HOST_CXXFLAGS  := -std=gnu++17 -O2 -g -Wall -DCANALUX_HOST
+HOST_INC       := -Ihost/inc -I$(INCDIR)
+HOST_BUILDDIR  := $(BUILDDIR)/host
+HOST_TARGETDIR := $(TARGETDIR)/host
+
+# Simulation-side game code (no rendering, no Tyra::Engine)
+HOST_SIM_SOURCES := \
+	src/components/stats.cpp \
+	src/core/camera.cpp \
+	src/core/fast_math.cpp \
+	src/core/profiler.cpp \
+	src/core/replay.cpp \
+	src/core/simulation.cpp \
+	src/entities/entity.cpp \
+	src/entities/player.cpp \
+	src/entities/projectile.cpp \
+	src/managers/bullet_emitter.cpp \
+	src/managers/collision_manager.cpp \
+	src/managers/lock_keeper_boss.cpp \
+	src/managers/mob_manager.cpp \
+	src/managers/nanny_boss.cpp \
+	src/managers/pike_boss.cpp \
+	src/managers/projectile_manager.cpp \
+	src/managers/projectile_store.cpp \
+	src/managers/sight_cache.cpp \
+	src/managers/spatial_grid.cpp \
+	src/world/flow_field.cpp \
+	src/world/level.cpp \
+	src/world/room.cpp \
+	src/world/room_generator.cpp \
+	host/src/host_tyra.cpp
+
+HOST_SIM_OBJECTS := $(patsubst %.cpp,$(HOST_BUILDDIR)/%.o,$(HOST_SIM_SOURCES))
+HOST_SIM_TARGET  := $(HOST_TARGETDIR)/canalux_sim
+
+# Benchmarks also cover tile emission
+HOST_BENCH_SOURCES := \
+	src/rendering/room_renderer.cpp
+
+HOST_BENCH_OBJECTS := $(patsubst %.cpp,$(HOST_BUILDDIR)/%.o,$(HOST_BENCH_SOURCES))
+HOST_BENCH_TARGET  := $(HOST_TARGETDIR)/canalux_bench
+
+HOST_FRAMES ?= 3600
+HOST_SEED   ?= 1
+HOST_ARGS   ?=
+BENCH_ARGS  ?=
+
+.PHONY: host run-host bench run-bench clean-host
+
+host: $(HOST_SIM_TARGET)
+
+run-host: $(HOST_SIM_TARGET)
+	$(HOST_SIM_TARGET) --frames $(HOST_FRAMES) --seed $(HOST_SEED) $(HOST_ARGS)
+
+bench: $(HOST_BENCH_TARGET)
+
+run-bench: $(HOST_BENCH_TARGET)
+	$(HOST_BENCH_TARGET) $(BENCH_ARGS)
+
+clean-host:
+	rm -rf $(HOST_BUILDDIR) $(HOST_TARGETDIR)
+
+$(HOST_SIM_TARGET): $(HOST_SIM_OBJECTS) $(HOST_BUILDDIR)/host/src/sim_main.o
+	@mkdir -p $(dir $@)
+	$(HOST_CXX) $(HOST_CXXFLAGS) -o $@ $^
+
+$(HOST_BENCH_TARGET): $(HOST_SIM_OBJECTS) $(HOST_BENCH_OBJECTS) $(HOST_BUILDDIR)/host/src/bench_main.o
+	@mkdir -p $(dir $@)
+	$(HOST_CXX) $(HOST_CXXFLAGS) -o $@ $^
+
+$(HOST_BUILDDIR)/%.o: %.cpp
+	@mkdir -p $(dir $@)
+	$(HOST_CXX) $(HOST_CXXFLAGS) $(HOST_INC) -MMD -MP -c -o $@ $<
+
+-include $(wildcard $(HOST_BUILDDIR)/*/*.d $(HOST_BUILDDIR)/*/*/*.d $(HOST_BUILDDIR)/*/*/*/*.d)
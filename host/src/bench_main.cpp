@@ -0,0 +1,1115 @@
+/*
+ * CanalUx - Host Microbenchmarks
+ * Times the simulation and tile-emission hot paths natively and reports
+ * ns/op and heap allocations/op for each scenario.
+ *
+ * Usage: canalux_bench [--filter TEXT] [--min-ms MS]
+ */
+
+#include <tyra>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#include "core/constants.hpp"
+#include "core/clock.hpp"
+#include "core/fast_math.hpp"
+#include "core/random.hpp"
+#include "core/camera.hpp"
+#include "core/input.hpp"
+#include "world/room.hpp"
+#include "world/room_generator.hpp"
+#include "world/flow_field.hpp"
+#include "entities/player.hpp"
+#include "managers/projectile_manager.hpp"
+#include "managers/bullet_emitter.hpp"
+#include "managers/mob_manager.hpp"
+#include "managers/collision_manager.hpp"
+#include "rendering/room_renderer.hpp"
+
+using namespace CanalUx;
+
+// =============================================================================
+// Allocation counting - every global new in the process goes through here
+// =============================================================================
+
+namespace {
+uint64_t allocationCount = 0;
+}  // namespace
+
+void* operator new(std::size_t size) {
+    allocationCount++;
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+// =============================================================================
+// Runner
+// =============================================================================
+
+struct Options {
+    std::string filter;
+    float minMs;
+
+    Options() : minMs(200.0f) {}
+};
+
+class BenchRunner {
+public:
+    explicit BenchRunner(const Options& t_options) : options(t_options) {
+        std::printf("%-28s %10s %12s %11s  %s\n", "benchmark", "iters", "ns/op", "allocs/op", "notes");
+    }
+
+    bool wants(const std::string& name) const {
+        return options.filter.empty() || name.find(options.filter) != std::string::npos;
+    }
+
+    // reset() restores the scenario's starting state outside the timed region,
+    // op() is the measured operation. Returns the number of timed iterations.
+    template <typename Reset, typename Op>
+    long run(const std::string& name, Reset reset, Op op, const std::string& notes = "") {
+        if (!wants(name)) return 0;
+
+        for (int i = 0; i < 3; i++) {
+            reset();
+            op();
+        }
+
+        double totalMs = 0.0;
+        uint64_t totalAllocs = 0;
+        long iterations = 0;
+        while (totalMs < options.minMs && iterations < 10000000) {
+            reset();
+            uint64_t allocsBefore = allocationCount;
+            Clock::Ticks start = Clock::now();
+            op();
+            Clock::Ticks end = Clock::now();
+            totalAllocs += allocationCount - allocsBefore;
+            totalMs += Clock::elapsedMs(start, end);
+            iterations++;
+        }
+
+        std::printf("%-28s %10ld %12.1f %11.2f  %s\n", name.c_str(), iterations,
+                    totalMs * 1000000.0 / iterations,
+                    static_cast<double>(totalAllocs) / iterations, notes.c_str());
+        return iterations;
+    }
+
+private:
+    Options options;
+};
+
+// =============================================================================
+// Scenario helpers
+// =============================================================================
+
+// Scenario layouts - reseeded per scenario so each one is the same on every run
+Random scenarioRandom;
+
+void seedScenario(uint32_t seed) {
+    scenarioRandom = Random(seed);
+}
+
+float randomRange(float minValue, float maxValue) {
+    return scenarioRandom.nextFloat(minValue, maxValue);
+}
+
+void generateRoom(Room& room, RoomGenerator& generator, int width, int height, RoomType type) {
+    room.setType(type);
+    room.createDoor(-1, 0);
+    room.createDoor(1, 0);
+    room.createDoor(0, -1);
+    room.createDoor(0, 1);
+    room.generate(&generator, width, height);
+}
+
+// Thrown trolleys landed anywhere inside the walls
+void scatterTrolleys(Room& room, int count) {
+    for (int i = 0; i < count; i++) {
+        RoomObstacle trolley;
+        trolley.position = Tyra::Vec2(randomRange(2.0f, room.getWidth() - 3.0f), randomRange(2.0f, room.getHeight() - 3.0f));
+        room.addObstacle(trolley);
+    }
+}
+
+MobManager::MobData makeMob(float x, float y) {
+    MobManager::MobData mob;
+    mob.position = Tyra::Vec2(x, y);
+    mob.velocity = Tyra::Vec2(randomRange(-0.03f, 0.03f), randomRange(-0.03f, 0.03f));
+    mob.size = Tyra::Vec2(32.0f, 32.0f);
+    mob.type = MobType::DUCK;
+    mob.state = MobState::CHASING;
+    mob.health = 1000000.0f;  // Never dies, so every iteration does the same work
+    mob.maxHealth = mob.health;
+    mob.speed = 0.03f;
+    mob.storePreviousPosition();
+    return mob;
+}
+
+// =============================================================================
+// Benchmarks
+// =============================================================================
+
+void benchCollisions(BenchRunner& runner, int count) {
+    std::string name = "collision/" + std::to_string(count);
+    if (!runner.wants(name)) return;
+
+    seedScenario(1000 + count);
+    RoomGenerator generator;
+    Room room;
+    generateRoom(room, generator, Constants::PIKE_ROOM_WIDTH, Constants::PIKE_ROOM_HEIGHT, RoomType::NORMAL);
+
+    InputFrame input;
+    Player player(&input);
+    player.position = Tyra::Vec2(room.getWidth() / 2.0f, room.getHeight() / 2.0f);
+    player.velocity = Tyra::Vec2(0.05f, 0.02f);
+
+    MobManager mobManager;
+    ProjectileManager projectileManager;
+    projectileManager.setCapacity(count, count);
+    for (int i = 0; i < count; i++) {
+        mobManager.getMobs().push_back(makeMob(randomRange(2.0f, room.getWidth() - 3.0f),
+                                               randomRange(2.0f, room.getHeight() - 3.0f)));
+        Tyra::Vec2 position(randomRange(2.0f, room.getWidth() - 3.0f), randomRange(2.0f, room.getHeight() - 3.0f));
+        Tyra::Vec2 velocity(randomRange(-0.1f, 0.1f), randomRange(-0.1f, 0.1f));
+        if (i % 2 == 0) {
+            projectileManager.spawnPlayerProjectile(position, velocity, 1.0f);
+        } else {
+            projectileManager.spawnEnemyProjectile(position, velocity, 1.0f);
+        }
+    }
+
+    const Player playerStart = player;
+    const std::vector<MobManager::MobData> mobStart = mobManager.getMobs();
+    const ProjectileManager projectileStart = projectileManager;
+    CollisionManager collisionManager;
+
+    runner.run(name,
+        [&]() {
+            player = playerStart;
+            mobManager.getMobs() = mobStart;
+            projectileManager = projectileStart;
+        },
+        [&]() {
+            collisionManager.checkCollisions(&player, &mobManager, &projectileManager, &room,
+                                             Constants::SIM_STEP_MS);
+        },
+        std::to_string(count) + " mobs + " + std::to_string(count) + " projectiles");
+}
+
+void benchMobRepulsion(BenchRunner& runner, int count) {
+    std::string name = "mob_repulsion/" + std::to_string(count);
+    if (!runner.wants(name)) return;
+
+    // Pack mobs about one per tile so most neighbours overlap
+    seedScenario(2000 + count);
+    float side = std::sqrt(static_cast<float>(count));
+    MobManager mobManager;
+    for (int i = 0; i < count; i++) {
+        mobManager.getMobs().push_back(makeMob(randomRange(2.0f, 2.0f + side), randomRange(2.0f, 2.0f + side)));
+    }
+    const std::vector<MobManager::MobData> mobStart = mobManager.getMobs();
+
+    runner.run(name,
+        [&]() { mobManager.getMobs() = mobStart; },
+        [&]() { mobManager.applyMobRepulsion(); });
+}
+
+void benchMobUpdate(BenchRunner& runner, int count) {
+    std::string name = "mob_update/" + std::to_string(count);
+    if (!runner.wants(name)) return;
+
+    // Chasers and shooters spread over the largest arena around a player in
+    // the middle, so most of them are in the decimated tier (see
+    // MobManager::LOD_FULL_RATE_DISTANCE)
+    seedScenario(2500 + count);
+    RoomGenerator generator;
+    Room room;
+    generateRoom(room, generator, Constants::PIKE_ROOM_WIDTH, Constants::PIKE_ROOM_HEIGHT, RoomType::NORMAL);
+
+    InputFrame input;
+    Player player(&input);
+    player.position = Tyra::Vec2(room.getWidth() / 2.0f, room.getHeight() / 2.0f);
+
+    MobManager mobManager;
+    ProjectileManager projectileManager;
+    projectileManager.setCapacity(count);
+    int nearby = 0;
+    for (int i = 0; i < count; i++) {
+        MobManager::MobData mob = makeMob(randomRange(2.0f, room.getWidth() - 3.0f),
+                                          randomRange(2.0f, room.getHeight() - 3.0f));
+        mob.lodSlot = static_cast<uint8_t>(i % 4);
+        if (i >= count * 3 / 4) {
+            mob.type = MobType::SWAN;
+            mob.state = MobState::IDLE;
+            mob.speed = 0.012f;
+        }
+        float dx = mob.position.x - player.position.x;
+        float dy = mob.position.y - player.position.y;
+        if (dx * dx + dy * dy <= 36.0f) nearby++;
+        mobManager.getMobs().push_back(mob);
+    }
+    const std::vector<MobManager::MobData> mobStart = mobManager.getMobs();
+
+    runner.run(name,
+        [&]() {
+            mobManager.getMobs() = mobStart;
+            projectileManager.clear();
+        },
+        [&]() { mobManager.update(&room, &player, &projectileManager, Constants::SIM_STEP_MS); },
+        std::to_string(nearby) + " of " + std::to_string(count) + " within full-rate range");
+}
+
+void benchProjectileChurn(BenchRunner& runner, int count) {
+    std::string name = "projectile_churn/" + std::to_string(count);
+    if (!runner.wants(name)) return;
+
+    // Short-lived projectiles so a steady fraction expires and is replaced every step
+    seedScenario(3000 + count);
+    RoomGenerator generator;
+    Room room;
+    generateRoom(room, generator, Constants::PIKE_ROOM_WIDTH, Constants::PIKE_ROOM_HEIGHT, RoomType::NORMAL);
+    ProjectileManager projectileManager;
+    projectileManager.setCapacity(count);
+
+    runner.run(name,
+        []() {},
+        [&]() {
+            while (projectileManager.getCount() < count) {
+                float angle = randomRange(0.0f, 6.28f);
+                projectileManager.spawnEnemyProjectile(
+                    Tyra::Vec2(room.getWidth() / 2.0f, room.getHeight() / 2.0f),
+                    Tyra::Vec2(std::cos(angle) * 0.1f, std::sin(angle) * 0.1f),
+                    1.0f, randomRange(0.5f, 3.0f));
+            }
+            projectileManager.update(&room, Constants::SIM_STEP_MS);
+        },
+        "spawn to " + std::to_string(count) + " + update");
+}
+
+void benchObstacleQueries(BenchRunner& runner, int trolleys) {
+    std::string name = "obstacle_query/" + std::to_string(trolleys);
+    if (!runner.wants(name)) return;
+
+    // Late Lock Keeper fight: arena shrunk to its minimum width and the
+    // floor littered with trolleys
+    seedScenario(5000 + trolleys);
+    RoomGenerator generator;
+    Room room;
+    generateRoom(room, generator, Constants::LOCKKEEPER_ROOM_WIDTH, Constants::LOCKKEEPER_ROOM_HEIGHT, RoomType::BOSS);
+    for (int i = 0; i < room.getWidth(); i++) {
+        room.shrinkArenaHorizontal(1.0f);
+    }
+    scatterTrolleys(room, trolleys);
+
+    // One query per entity per axis, as the collision pass does
+    const int QUERIES = 256;
+    std::vector<Tyra::Vec2> points(QUERIES);
+    for (auto& point : points) {
+        point = Tyra::Vec2(randomRange(1.0f, room.getWidth() - 2.0f), randomRange(1.0f, room.getHeight() - 2.0f));
+    }
+    const Tyra::Vec2 entitySize(Constants::PLAYER_SIZE / Constants::TILE_SIZE,
+                                Constants::PLAYER_SIZE / Constants::TILE_SIZE);
+    volatile int hits = 0;
+
+    runner.run(name,
+        []() {},
+        [&]() {
+            int found = 0;
+            for (const auto& point : points) {
+                if (room.findObstacle(point, entitySize, ObstacleBlocks::PLAYER)) {
+                    found++;
+                }
+            }
+            hits = found;
+        },
+        std::to_string(QUERIES) + " queries, " + std::to_string(room.getObstacles().size()) + " obstacles");
+}
+
+void benchFlowField(BenchRunner& runner, int trolleys) {
+    std::string name = "flow_field/" + std::to_string(trolleys);
+    if (!runner.wants(name)) return;
+
+    // Largest arena, trolleys scattered for the paths to bend around. The
+    // player steps to another tile every op, so each op is a full rebuild
+    // plus a sample for every chaser.
+    seedScenario(6000 + trolleys);
+    RoomGenerator generator;
+    Room room;
+    generateRoom(room, generator, Constants::PIKE_ROOM_WIDTH, Constants::PIKE_ROOM_HEIGHT, RoomType::NORMAL);
+    scatterTrolleys(room, trolleys);
+
+    const int SAMPLES = 256;
+    std::vector<int> tiles(SAMPLES * 2);
+    for (auto& tile : tiles) {
+        tile = static_cast<int>(randomRange(2.0f, room.getWidth() - 3.0f));
+    }
+    FlowField flowField;
+    int target = 0;
+    volatile int steps = 0;
+
+    runner.run(name,
+        []() {},
+        [&]() {
+            target = (target + 1) % SAMPLES;
+            flowField.update(&room, tiles[target * 2], tiles[target * 2 + 1] % room.getHeight());
+            int found = 0;
+            for (int i = 0; i < SAMPLES; i++) {
+                int nextX, nextY;
+                if (flowField.getNextTile(tiles[i * 2], tiles[i * 2 + 1] % room.getHeight(), nextX, nextY)) {
+                    found++;
+                }
+            }
+            steps = found;
+        },
+        "rebuild + " + std::to_string(SAMPLES) + " samples, " + std::to_string(room.getObstacles().size()) + " obstacles");
+}
+
+void benchLineOfSight(BenchRunner& runner, int trolleys) {
+    std::string name = "line_of_sight/" + std::to_string(trolleys);
+    if (!runner.wants(name)) return;
+
+    // Same arena as the flow field; sight lines of every length between
+    // random points, as shooters anywhere in the room would trace them
+    seedScenario(6500 + trolleys);
+    RoomGenerator generator;
+    Room room;
+    generateRoom(room, generator, Constants::PIKE_ROOM_WIDTH, Constants::PIKE_ROOM_HEIGHT, RoomType::NORMAL);
+    scatterTrolleys(room, trolleys);
+
+    const int LINES = 256;
+    std::vector<Tyra::Vec2> points(LINES * 2);
+    for (auto& point : points) {
+        point = Tyra::Vec2(randomRange(1.0f, room.getWidth() - 1.0f), randomRange(1.0f, room.getHeight() - 1.0f));
+    }
+    volatile int clear = 0;
+
+    runner.run(name,
+        []() {},
+        [&]() {
+            int visible = 0;
+            for (int i = 0; i < LINES; i++) {
+                if (room.hasLineOfSight(points[i * 2], points[i * 2 + 1], ObstacleBlocks::ENEMY_SHOTS)) {
+                    visible++;
+                }
+            }
+            clear = visible;
+        },
+        std::to_string(LINES) + " sight lines, " + std::to_string(room.getObstacles().size()) + " obstacles");
+}
+
+void benchProjectileUpdate(BenchRunner& runner, int count) {
+    std::string name = "projectile_update/" + std::to_string(count);
+    if (!runner.wants(name)) return;
+
+    // Boss-fight mix: mostly plain shots, every fourth one accelerating
+    seedScenario(3500 + count);
+    ProjectileManager projectileManager;
+    projectileManager.setCapacity(count);
+    for (int i = 0; i < count; i++) {
+        float angle = randomRange(0.0f, 6.28f);
+        Tyra::Vec2 position(randomRange(2.0f, 20.0f), randomRange(2.0f, 16.0f));
+        Tyra::Vec2 velocity(std::cos(angle) * 0.1f, std::sin(angle) * 0.1f);
+        if (i % 4 == 0) {
+            projectileManager.spawnAcceleratingProjectile(position, velocity * 0.2f, 1.0f, 0.01f, 0.2f);
+        } else {
+            projectileManager.spawnEnemyProjectile(position, velocity, 1.0f, 100.0f);
+        }
+    }
+    const ProjectileManager projectileStart = projectileManager;
+
+    runner.run(name,
+        [&]() { projectileManager = projectileStart; },
+        [&]() { projectileManager.update(nullptr, Constants::SIM_STEP_MS); },
+        std::to_string(count) + " projectiles");
+}
+
+void benchRoomRender(BenchRunner& runner, int width, int height, const char* label) {
+    std::string name = "room_render/" + std::to_string(width) + "x" + std::to_string(height);
+    if (!runner.wants(name)) return;
+
+    seedScenario(4000 + width * 100 + height);
+    RoomGenerator generator;
+    Room room;
+    generateRoom(room, generator, width, height, RoomType::NORMAL);
+
+    Camera camera;
+    camera.follow(Tyra::Vec2(width / 2.0f, height / 2.0f));
+    camera.clampToRoom(&room);
+
+    Tyra::TextureRepository textureRepo;
+    Tyra::Renderer2D renderer2D;
+    RoomRenderer roomRenderer;
+    roomRenderer.init(&textureRepo);
+
+    // One pass up front to report how many sprites each render submits
+    roomRenderer.render(&renderer2D, &room, &camera);
+    uint64_t spritesPerRender = renderer2D.getSpritesRendered();
+
+    runner.run(name,
+        []() {},
+        [&]() { roomRenderer.render(&renderer2D, &room, &camera); },
+        std::to_string(spritesPerRender) + " sprites, " + label);
+}
+
+// =============================================================================
+// Projectile handles - stale handles must stop resolving
+// =============================================================================
+
+// Returns false if a handle still resolves after its projectile was
+// removed, or after its slot went to a new projectile, or if a live handle
+// resolves to the wrong projectile
+bool checkProjectileHandles(const BenchRunner& runner) {
+    if (!runner.wants("projectile_handle")) return true;
+
+    ProjectileManager projectileManager;
+    projectileManager.setCapacity(2, 2);
+    ProjectileStore dummyStore;
+    ProjectileRef projectile(&dummyStore, 0);
+
+    // Two live shots: each handle finds its own
+    ProjectileHandle first = projectileManager.spawnEnemyProjectile(Tyra::Vec2(1.0f, 1.0f), Tyra::Vec2(0, 0), 1.0f);
+    ProjectileHandle second = projectileManager.spawnEnemyProjectile(Tyra::Vec2(2.0f, 2.0f), Tyra::Vec2(0, 0), 1.0f);
+    bool liveOk = projectileManager.tryGet(first, projectile) && projectile.getPosition().x == 1.0f &&
+                  projectileManager.tryGet(second, projectile) && projectile.getPosition().x == 2.0f;
+
+    // Destroy the first: still resolvable until the update removes it, then
+    // stale, and the second moves down into its packed index
+    projectileManager.tryGet(first, projectile);
+    projectile.destroy();
+    bool pendingOk = projectileManager.isAlive(first);
+    projectileManager.update(nullptr, Constants::SIM_STEP_MS);
+    bool removedOk = !projectileManager.isAlive(first) && !projectileManager.tryGet(first, projectile) &&
+                     projectileManager.tryGet(second, projectile) && projectile.getPosition().x == 2.0f;
+
+    // A new shot takes the freed slot: the old handle must not find it
+    ProjectileHandle third = projectileManager.spawnEnemyProjectile(Tyra::Vec2(3.0f, 3.0f), Tyra::Vec2(0, 0), 1.0f);
+    bool reusedOk = third.index == first.index && !projectileManager.tryGet(first, projectile) &&
+                    projectileManager.tryGet(third, projectile) && projectile.getPosition().x == 3.0f;
+
+    // Never-valid and out-of-range handles
+    bool invalidOk = !projectileManager.tryGet(ProjectileHandle(), projectile) &&
+                     !projectileManager.tryGet(ProjectileHandle(0x7FFF, 1), projectile);
+
+    const struct { const char* name; bool ok; } stages[] = {
+        {"projectile_handle_check/live", liveOk},
+        {"projectile_handle_check/destroyed", pendingOk},
+        {"projectile_handle_check/removed", removedOk},
+        {"projectile_handle_check/reused", reusedOk},
+        {"projectile_handle_check/invalid", invalidOk},
+    };
+    bool ok = true;
+    for (const auto& stage : stages) {
+        std::printf("%-28s %s\n", stage.name, stage.ok ? "ok" : "FAILED");
+        ok &= stage.ok;
+    }
+    return ok;
+}
+
+// =============================================================================
+// Room templates - template-backed rooms against freshly generated tiles
+// =============================================================================
+
+// Cells where two rooms' tiles or collision differ
+int countCellMismatches(const Room& a, const Room& b) {
+    int mismatches = 0;
+    for (int y = 0; y < a.getHeight(); y++) {
+        for (int x = 0; x < a.getWidth(); x++) {
+            const RoomCell& cellA = a.cellAt(x, y);
+            const RoomCell& cellB = b.cellAt(x, y);
+            if (cellA.water != cellB.water || cellA.land != cellB.land ||
+                cellA.scenery != cellB.scenery || cellA.collision != cellB.collision) {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+bool reportMismatches(const char* name, int mismatches) {
+    bool ok = mismatches == 0;
+    std::printf("%-28s %d mismatched cells %s\n", name, mismatches, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+// Returns false if a room sharing a generator template ever differs from
+// one that owns its tiles from the start (generated layer by layer, with
+// collision worked out per cell), through the copy-on-write edits rooms
+// get: danger signs, Nanny side doors, and clearing (which swaps an
+// unedited room to the cleared template instead of editing it)
+bool checkRoomTemplates(const BenchRunner& runner) {
+    if (!runner.wants("room_template")) return true;
+
+    RoomGenerator generator;
+    int createMismatches = 0;
+    int signMismatches = 0;
+    int sideDoorMismatches = 0;
+    int clearMismatches = 0;
+    bool sharedUntilEdited = true;
+
+    const int sizes[][2] = {
+        {Constants::ROOM_MIN_WIDTH, Constants::ROOM_MIN_HEIGHT},
+        {Constants::ROOM_MAX_WIDTH, Constants::ROOM_MAX_HEIGHT},
+        {Constants::LOCKKEEPER_ROOM_WIDTH, Constants::LOCKKEEPER_ROOM_HEIGHT},
+        {Constants::NANNY_ROOM_WIDTH, Constants::NANNY_ROOM_HEIGHT},
+    };
+    for (const auto& size : sizes) {
+        int width = size[0];
+        int height = size[1];
+        for (int doors = 0; doors < 16; doors++) {
+            // 0: no edits, 1: danger signs at every door, 2: Nanny side
+            // doors (only the Nanny's room is tall enough to fit any)
+            bool nannyRoom = width == Constants::NANNY_ROOM_WIDTH && height == Constants::NANNY_ROOM_HEIGHT;
+            for (int edits = 0; edits < (nannyRoom ? 3 : 2); edits++) {
+                Room shared;
+                Room fresh;
+                for (Room* room : {&shared, &fresh}) {
+                    room->setType(RoomType::NORMAL);
+                    if (doors & 1) room->createDoor(-1, 0);
+                    if (doors & 2) room->createDoor(1, 0);
+                    if (doors & 4) room->createDoor(0, -1);
+                    if (doors & 8) room->createDoor(0, 1);
+                }
+                shared.generate(&generator, width, height);
+                fresh.generate(nullptr, width, height);
+                sharedUntilEdited &= shared.isUsingTemplate();
+
+                std::vector<RoomCell> cells(width * height);
+                bool left = (doors & 1) != 0;
+                bool right = (doors & 2) != 0;
+                bool top = (doors & 4) != 0;
+                bool bottom = (doors & 8) != 0;
+                generator.generateWater(cells, width, height, left, right, top, bottom);
+                generator.generateLand(cells, width, height, left, right, top, bottom);
+                generator.generateScenery(cells, width, height, left, right, top, bottom, false);
+                for (int y = 0; y < height; y++) {
+                    for (int x = 0; x < width; x++) {
+                        const RoomCell& cell = cells[y * width + x];
+                        fresh.setWaterTile(x, y, cell.water);
+                        fresh.setLandTile(x, y, cell.land);
+                        fresh.setSceneryTile(x, y, cell.scenery);
+                    }
+                }
+                createMismatches += countCellMismatches(shared, fresh);
+
+                if (edits == 1) {
+                    for (int direction = 0; direction < 4; direction++) {
+                        if (doors & (1 << direction)) {
+                            generator.placeDangerSigns(&shared, direction);
+                            generator.placeDangerSigns(&fresh, direction);
+                        }
+                    }
+                    signMismatches += countCellMismatches(shared, fresh);
+                    sharedUntilEdited &= doors == 0 || !shared.isUsingTemplate();
+                } else if (edits == 2) {
+                    generator.generateNannySideDoors(&shared, 3);
+                    generator.generateNannySideDoors(&fresh, 3);
+                    sideDoorMismatches += countCellMismatches(shared, fresh);
+                    sharedUntilEdited &= !shared.isUsingTemplate();
+                }
+
+                shared.completeClear();
+                fresh.completeClear();
+                clearMismatches += countCellMismatches(shared, fresh);
+            }
+        }
+    }
+
+    bool ok = true;
+    ok &= reportMismatches("room_template_check/create", createMismatches);
+    ok &= reportMismatches("room_template_check/signs", signMismatches);
+    ok &= reportMismatches("room_template_check/side_doors", sideDoorMismatches);
+    ok &= reportMismatches("room_template_check/clear", clearMismatches);
+    std::printf("%-28s rooms share templates until edited %s\n", "room_template_check/sharing",
+                sharedUntilEdited ? "ok" : "FAILED");
+    return ok && sharedUntilEdited;
+}
+
+// =============================================================================
+// Room queries - flow field and line of sight against brute force
+// =============================================================================
+
+// Reference sight line: sample the segment every 1/256 tile and look at
+// the tile and every blocking obstacle under each sample
+bool tracedLineOfSight(const Room& room, const Tyra::Vec2& from, const Tyra::Vec2& to, uint8_t blocks) {
+    Tyra::Vec2 delta = to - from;
+    int samples = 1 + static_cast<int>(std::ceil(std::sqrt(delta.x * delta.x + delta.y * delta.y) * 256.0f));
+    for (int i = 0; i <= samples; i++) {
+        Tyra::Vec2 point = from + delta * (static_cast<float>(i) / samples);
+        int x = static_cast<int>(std::floor(point.x));
+        int y = static_cast<int>(std::floor(point.y));
+        if (room.isInBounds(x, y) && room.isSolid(x, y)) return false;
+        for (const RoomObstacle& obs : room.getObstacles()) {
+            if (!(obs.getBlocks() & blocks)) continue;
+            if (point.x > obs.position.x && point.x < obs.position.x + obs.size.x &&
+                point.y > obs.position.y && point.y < obs.position.y + obs.size.y) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Returns false if a flow-field step ever fails to move closer to the
+// target, or Room::hasLineOfSight misses a wall or obstacle the sampled
+// trace hits (it may see a blocker the samples step over - a line
+// grazing a corner - but only rarely)
+bool checkRoomQueries(const BenchRunner& runner) {
+    if (!runner.wants("room_query")) return true;
+
+    seedScenario(7000);
+    RoomGenerator generator;
+    Room room;
+    generateRoom(room, generator, Constants::PIKE_ROOM_WIDTH, Constants::PIKE_ROOM_HEIGHT, RoomType::NORMAL);
+    scatterTrolleys(room, 16);
+
+    // Every reachable tile must have a next step, one tile strictly closer
+    FlowField flowField;
+    int badSteps = 0;
+    int stepsChecked = 0;
+    for (int targetY = 1; targetY < room.getHeight() - 1; targetY += 3) {
+        for (int targetX = 1; targetX < room.getWidth() - 1; targetX += 3) {
+            flowField.update(&room, targetX, targetY);
+            for (int y = 0; y < room.getHeight(); y++) {
+                for (int x = 0; x < room.getWidth(); x++) {
+                    uint16_t distance = flowField.getDistance(x, y);
+                    int nextX, nextY;
+                    bool hasNext = flowField.getNextTile(x, y, nextX, nextY);
+                    if (distance == FlowField::UNREACHABLE || distance == 0) {
+                        badSteps += hasNext ? 1 : 0;
+                        continue;
+                    }
+                    stepsChecked++;
+                    if (!hasNext || flowField.getDistance(nextX, nextY) >= distance) {
+                        badSteps++;
+                    }
+                }
+            }
+        }
+    }
+
+    const int LINES = 40000;
+    int missed = 0;
+    int grazed = 0;
+    for (int i = 0; i < LINES; i++) {
+        Tyra::Vec2 from(randomRange(0.5f, room.getWidth() - 0.5f), randomRange(0.5f, room.getHeight() - 0.5f));
+        Tyra::Vec2 to(randomRange(0.5f, room.getWidth() - 0.5f), randomRange(0.5f, room.getHeight() - 0.5f));
+        bool sight = room.hasLineOfSight(from, to, ObstacleBlocks::ENEMY_SHOTS);
+        bool traced = tracedLineOfSight(room, from, to, ObstacleBlocks::ENEMY_SHOTS);
+        if (sight && !traced) missed++;
+        if (!sight && traced) grazed++;
+    }
+
+    bool flowOk = badSteps == 0;
+    bool sightOk = missed == 0 && grazed <= LINES / 1000;
+    std::printf("%-28s %d bad of %d steps %s\n", "room_query_check/flow_field", badSteps, stepsChecked,
+                flowOk ? "ok" : "FAILED");
+    std::printf("%-28s %d missed, %d grazed of %d lines %s\n", "room_query_check/sight", missed, grazed, LINES,
+                sightOk ? "ok" : "FAILED");
+    return flowOk && sightOk;
+}
+
+// =============================================================================
+// Fast math - accuracy against libm, then speed against libm
+// =============================================================================
+
+bool reportAccuracy(const char* name, double maxError, double limit, const char* unit) {
+    bool ok = maxError <= limit;
+    std::printf("%-28s max error %.2e %s (limit %.0e) %s\n", name, maxError, unit, limit, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+// Returns false if any approximation is outside the bounds documented in
+// core/fast_math.hpp
+bool checkFastMath(const BenchRunner& runner) {
+    if (!runner.wants("fast_math")) return true;
+    bool ok = true;
+
+    // sin/cos over several turns either side of zero
+    double sinError = 0.0;
+    double cosError = 0.0;
+    for (int i = 0; i <= 200000; i++) {
+        float angle = -4.0f * FastMath::TWO_PI + i * (8.0f * FastMath::TWO_PI / 200000);
+        float s, c;
+        FastMath::sinCos(angle, s, c);
+        sinError = std::max(sinError, std::fabs(s - std::sin(static_cast<double>(angle))));
+        cosError = std::max(cosError, std::fabs(c - std::cos(static_cast<double>(angle))));
+    }
+    ok &= reportAccuracy("fast_math_check/sin", sinError, 1e-4, "");
+    ok &= reportAccuracy("fast_math_check/cos", cosError, 1e-4, "");
+
+    // atan2 all the way round, at tiny to large radii, plus the axes
+    double atanError = 0.0;
+    const float radii[] = {1e-4f, 0.5f, 1.0f, 37.0f, 1e5f};
+    for (float radius : radii) {
+        for (int i = 0; i < 100000; i++) {
+            double angle = -3.14159265358979 + i * (6.28318530717959 / 100000);
+            float y = static_cast<float>(std::sin(angle) * radius);
+            float x = static_cast<float>(std::cos(angle) * radius);
+            double error = std::fabs(FastMath::atan2(y, x) - std::atan2(static_cast<double>(y), static_cast<double>(x)));
+            // -PI and PI are the same direction
+            atanError = std::max(atanError, std::min(error, std::fabs(error - 6.28318530717959)));
+        }
+    }
+    ok &= reportAccuracy("fast_math_check/atan2", atanError, 2e-5, "rad");
+
+    // sqrt/rsqrt relative error across the range gameplay uses
+    double sqrtError = 0.0;
+    double rsqrtError = 0.0;
+    for (int i = 0; i <= 100000; i++) {
+        float x = static_cast<float>(std::pow(10.0, -6.0 + i * (12.0 / 100000)));
+        double exact = std::sqrt(static_cast<double>(x));
+        sqrtError = std::max(sqrtError, std::fabs(FastMath::sqrt(x) - exact) / exact);
+        rsqrtError = std::max(rsqrtError, std::fabs(FastMath::rsqrt(x) * exact - 1.0));
+    }
+    ok &= reportAccuracy("fast_math_check/sqrt", sqrtError, 1e-5, "rel");
+    ok &= reportAccuracy("fast_math_check/rsqrt", rsqrtError, 1e-5, "rel");
+    return ok;
+}
+
+void benchMath(BenchRunner& runner) {
+    // Angles and vectors like the boss patterns and aiming code use
+    const int COUNT = 1024;
+    seedScenario(7000);
+    std::vector<float> angles(COUNT);
+    std::vector<float> xs(COUNT);
+    std::vector<float> ys(COUNT);
+    for (int i = 0; i < COUNT; i++) {
+        angles[i] = randomRange(-10.0f, 10.0f);
+        xs[i] = randomRange(-20.0f, 20.0f);
+        ys[i] = randomRange(-20.0f, 20.0f);
+    }
+    volatile float sink = 0.0f;
+    std::string notes = std::to_string(COUNT) + " calls";
+
+    runner.run("fast_math/sincos", []() {}, [&]() {
+        float sum = 0.0f;
+        for (float angle : angles) {
+            float s, c;
+            FastMath::sinCos(angle, s, c);
+            sum += s + c;
+        }
+        sink = sum;
+    }, notes);
+    runner.run("std_math/sincos", []() {}, [&]() {
+        float sum = 0.0f;
+        for (float angle : angles) {
+            sum += std::sin(angle) + std::cos(angle);
+        }
+        sink = sum;
+    }, notes);
+
+    runner.run("fast_math/atan2", []() {}, [&]() {
+        float sum = 0.0f;
+        for (int i = 0; i < COUNT; i++) {
+            sum += FastMath::atan2(ys[i], xs[i]);
+        }
+        sink = sum;
+    }, notes);
+    runner.run("std_math/atan2", []() {}, [&]() {
+        float sum = 0.0f;
+        for (int i = 0; i < COUNT; i++) {
+            sum += std::atan2(ys[i], xs[i]);
+        }
+        sink = sum;
+    }, notes);
+
+    runner.run("fast_math/normalize", []() {}, [&]() {
+        float sum = 0.0f;
+        for (int i = 0; i < COUNT; i++) {
+            float invLength = FastMath::rsqrt(xs[i] * xs[i] + ys[i] * ys[i] + 1e-6f);
+            sum += xs[i] * invLength + ys[i] * invLength;
+        }
+        sink = sum;
+    }, notes);
+    runner.run("std_math/normalize", []() {}, [&]() {
+        float sum = 0.0f;
+        for (int i = 0; i < COUNT; i++) {
+            float length = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i] + 1e-6f);
+            sum += xs[i] / length + ys[i] / length;
+        }
+        sink = sum;
+    }, notes);
+}
+
+// =============================================================================
+// Bullet patterns - emitter volleys against per-bullet trig, then speed
+// =============================================================================
+
+// One of each shape, at boss-attack sizes
+const int BULLET_PATTERN_COUNT = 5;
+const char* const BULLET_PATTERN_NAMES[BULLET_PATTERN_COUNT] = {"ring", "arc", "spiral", "aimed_volley", "wave"};
+
+BulletPattern makeBulletPattern(int index, int count) {
+    BulletPattern pattern;
+    switch (index) {
+        case 0: pattern = BulletPattern::ring(count, 0.12f); pattern.spawnRadius = 3.0f; break;
+        case 1: pattern = BulletPattern::arc(count, 1.3f, 0.06f); break;
+        case 2: pattern = BulletPattern::spiral(count, 0.7f, 0.1f); break;
+        case 3: pattern = BulletPattern::aimedVolley(count, 0.15f, 0.07f); break;
+        default: pattern = BulletPattern::wave(count, 4.0f, 0.08f); pattern.spawnRadius = 1.0f; break;
+    }
+    pattern.maxRange = 40.0f;
+    return pattern;
+}
+
+// Bullet i of a volley fired along 'angle', worked out directly in double
+void referenceBullet(const BulletPattern& pattern, int i, double angle, const Tyra::Vec2& origin,
+                     double& posX, double& posY, double& velX, double& velY) {
+    int count = pattern.count;
+    double t = count > 1 ? static_cast<double>(i) / (count - 1) : 0.5;
+    double side = 0.0;
+    if (pattern.shape == BulletShape::RING || pattern.shape == BulletShape::SPIRAL) {
+        angle += 6.28318530717959 * i / count;
+    } else if (pattern.shape == BulletShape::ARC) {
+        angle += pattern.spread * (t - 0.5);
+    } else if (pattern.shape == BulletShape::WAVE) {
+        side = pattern.spread * (t - 0.5);
+    }
+
+    double c = std::cos(angle);
+    double s = std::sin(angle);
+    double sideSpeed = pattern.shape == BulletShape::AIMED_VOLLEY ? (i - (count - 1) / 2.0) * pattern.spread : 0.0;
+    velX = c * pattern.speed - s * sideSpeed;
+    velY = s * pattern.speed + c * sideSpeed;
+    posX = origin.x + c * pattern.spawnRadius - s * side;
+    posY = origin.y + s * pattern.spawnRadius + c * side;
+}
+
+// Returns false if an emitter volley strays from the directly computed one
+// by more than the sin/cos table error allows, or drops bullets
+bool checkBulletPatterns(const BenchRunner& runner) {
+    if (!runner.wants("bullet_pattern")) return true;
+    bool ok = true;
+
+    ProjectileManager projectileManager;
+    projectileManager.setCapacity(64);
+    Tyra::Vec2 origin(12.0f, 9.0f);
+    for (int index = 0; index < BULLET_PATTERN_COUNT; index++) {
+        BulletPattern pattern = makeBulletPattern(index, 7);
+        BulletEmitter emitter(pattern);
+
+        double maxError = 0.0;
+        for (int fire = 1; fire <= 100; fire++) {
+            // Alternate the angle and unit-vector aims
+            double angle = -3.1 + fire * 0.062;
+            projectileManager.clear();
+            if (fire % 2 == 0) {
+                emitter.fire(&projectileManager, origin, static_cast<float>(angle));
+            } else {
+                Tyra::Vec2 aim(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+                emitter.fire(&projectileManager, origin, aim);
+            }
+            if (pattern.shape == BulletShape::SPIRAL) angle += pattern.spin * fire;
+
+            if (projectileManager.getCount() != pattern.count) maxError = 1.0;
+            int i = 0;
+            for (auto projectile : projectileManager.getEnemyProjectiles()) {
+                double posX, posY, velX, velY;
+                referenceBullet(pattern, i++, angle, origin, posX, posY, velX, velY);
+
+                // Relative to the reference offset and speed
+                Tyra::Vec2 position = projectile.getPosition();
+                Tyra::Vec2 velocity = projectile.getVelocity();
+                double offset = std::hypot(posX - origin.x, posY - origin.y);
+                double speed = std::hypot(velX, velY);
+                if (offset > 0.0) {
+                    maxError = std::max(maxError, std::hypot(position.x - posX, position.y - posY) / offset);
+                }
+                maxError = std::max(maxError, std::hypot(velocity.x - velX, velocity.y - velY) / speed);
+            }
+        }
+        std::string name = std::string("bullet_pattern_check/") + BULLET_PATTERN_NAMES[index];
+        ok &= reportAccuracy(name.c_str(), maxError, 3e-4, "rel");
+    }
+    return ok;
+}
+
+void benchBulletPatterns(BenchRunner& runner, int count) {
+    ProjectileManager projectileManager;
+    projectileManager.setCapacity(count);
+    Tyra::Vec2 origin(12.0f, 9.0f);
+    std::string notes = std::to_string(count) + " bullets/volley";
+
+    for (int index = 0; index < BULLET_PATTERN_COUNT; index++) {
+        BulletEmitter emitter(makeBulletPattern(index, count));
+        float angle = 0.0f;
+        runner.run(std::string("bullet_pattern/") + BULLET_PATTERN_NAMES[index] + "/" + std::to_string(count),
+            [&]() { projectileManager.clear(); },
+            [&]() {
+                angle += 0.1f;
+                emitter.fire(&projectileManager, origin, angle);
+            },
+            notes);
+    }
+
+    // The same ring built one bullet at a time, the way boss code used to
+    BulletPattern ring = makeBulletPattern(0, count);
+    float angle = 0.0f;
+    runner.run("bullet_pattern/ring_per_bullet/" + std::to_string(count),
+        [&]() { projectileManager.clear(); },
+        [&]() {
+            angle += 0.1f;
+            for (int i = 0; i < count; i++) {
+                float s, c;
+                FastMath::sinCos(angle + (FastMath::TWO_PI / count) * i, s, c);
+                Tyra::Vec2 position(origin.x + c * ring.spawnRadius, origin.y + s * ring.spawnRadius);
+                projectileManager.spawnEnemyProjectile(position, Tyra::Vec2(c * ring.speed, s * ring.speed),
+                                                       ring.damage, ring.maxRange);
+            }
+        },
+        notes);
+}
+
+void benchBossFight(BenchRunner& runner, int level, int width, int height, const char* label) {
+    std::string name = std::string("boss_fight/") + label;
+    if (!runner.wants(name)) return;
+
+    // Ten seconds of a phase 3 fight (the largest volleys) against a player
+    // standing still near the bottom. Respawning the boss between runs must
+    // keep every emitter's storage, so a warmed-up fight allocates nothing.
+    const int FRAMES = 600;
+    RoomGenerator generator;
+    Room room;
+    generateRoom(room, generator, width, height, RoomType::BOSS);
+
+    InputFrame input;
+    Player player(&input);
+    player.position = Tyra::Vec2(width / 2.0f, height - 3.0f);
+
+    MobManager mobManager;
+    ProjectileManager projectileManager;
+
+    runner.run(name,
+        [&]() {
+            room.clearObstacles();
+            room.generate(&generator, width, height);
+            mobManager.spawnMobsForRoom(&room, level, 9000 + level);
+            MobManager::MobData& boss = mobManager.getMobs().front();
+            boss.health = boss.maxHealth * 0.2f;
+            projectileManager.clear();
+        },
+        [&]() {
+            for (int frame = 0; frame < FRAMES; frame++) {
+                mobManager.update(&room, &player, &projectileManager, Constants::SIM_STEP_MS);
+                projectileManager.update(&room, Constants::SIM_STEP_MS);
+            }
+        },
+        std::to_string(FRAMES) + " frames, phase 3");
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--filter") == 0 && hasValue) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(arg, "--min-ms") == 0 && hasValue) {
+            options.minMs = static_cast<float>(std::atof(argv[++i]));
+        } else {
+            std::fprintf(stderr, "Usage: %s [--filter TEXT] [--min-ms MS]\n", argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    BenchRunner runner(options);
+
+    if (!checkProjectileHandles(runner) || !checkRoomTemplates(runner) || !checkRoomQueries(runner) ||
+        !checkFastMath(runner) || !checkBulletPatterns(runner)) {
+        return 1;
+    }
+
+    const int entityCounts[] = {10, 100, 1000};
+    for (int count : entityCounts) {
+        benchCollisions(runner, count);
+    }
+
+    const int mobCounts[] = {10, 50, 100, 250, 500, 1000};
+    for (int count : mobCounts) {
+        benchMobRepulsion(runner, count);
+    }
+
+    for (int count : entityCounts) {
+        benchMobUpdate(runner, count);
+    }
+
+    for (int count : entityCounts) {
+        benchProjectileChurn(runner, count);
+    }
+    for (int count : entityCounts) {
+        benchProjectileUpdate(runner, count);
+    }
+
+    const int trolleyCounts[] = {0, 32, 128};
+    for (int count : trolleyCounts) {
+        benchObstacleQueries(runner, count);
+    }
+    for (int count : trolleyCounts) {
+        benchFlowField(runner, count);
+    }
+    for (int count : trolleyCounts) {
+        benchLineOfSight(runner, count);
+    }
+
+    benchMath(runner);
+
+    const int volleySizes[] = {8, 48};
+    for (int count : volleySizes) {
+        benchBulletPatterns(runner, count);
+    }
+
+    benchBossFight(runner, 1, Constants::PIKE_ROOM_WIDTH, Constants::PIKE_ROOM_HEIGHT, "pike");
+    benchBossFight(runner, 2, Constants::LOCKKEEPER_ROOM_WIDTH, Constants::LOCKKEEPER_ROOM_HEIGHT, "lock_keeper");
+    benchBossFight(runner, 3, Constants::NANNY_ROOM_WIDTH, Constants::NANNY_ROOM_HEIGHT, "nanny");
+
+    // Every room size the level generator can produce (dimensions rounded to even)
+    for (int width = Constants::ROOM_MIN_WIDTH; width <= Constants::ROOM_MAX_WIDTH; width += 2) {
+        benchRoomRender(runner, width, Constants::ROOM_MIN_HEIGHT, "normal");
+    }
+    for (int height = Constants::ROOM_MIN_HEIGHT + 2; height <= Constants::ROOM_MAX_HEIGHT; height += 2) {
+        benchRoomRender(runner, Constants::ROOM_MIN_WIDTH, height, "normal");
+    }
+    benchRoomRender(runner, Constants::PIKE_ROOM_WIDTH, Constants::PIKE_ROOM_HEIGHT, "pike boss");
+    benchRoomRender(runner, Constants::LOCKKEEPER_ROOM_WIDTH, Constants::LOCKKEEPER_ROOM_HEIGHT, "lock keeper boss");
+    benchRoomRender(runner, Constants::NANNY_ROOM_WIDTH, Constants::NANNY_ROOM_HEIGHT, "nanny boss");
+
+    return 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * CanalUx - Host Tyra Stand-in Implementation
+ */
+
+#include <tyra>
+
+namespace Tyra {
+namespace Host {
+
+namespace {
+
+constexpr double TIMER_TICKS_PER_MS = 576.0;  // BUSCLK / 256
+
+double virtualTimeMs = 0.0;
+bool logEnabled = false;
+
+}  // namespace
+
+void advanceTime(float ms) {
+    virtualTimeMs += ms;
+}
+
+u32 getTimerTicks() {
+    return static_cast<u32>(static_cast<uint64_t>(virtualTimeMs * TIMER_TICKS_PER_MS));
+}
+
+void setLogEnabled(bool enabled) {
+    logEnabled = enabled;
+}
+
+bool isLogEnabled() {
+    return logEnabled;
+}
+
+}  // namespace Host
+}  // namespace Tyra
@@ -0,0 +1,344 @@
+/*
+ * CanalUx - Headless Simulation Harness
+ * Runs the game simulation natively for a fixed number of frames from a fixed
+ * seed with scripted input, or plays back a recorded replay. No rendering.
+ *
+ * Usage: canalux_sim [--frames N] [--seed S] [--level L] [--boss|--no-boss]
+ *                    [--record FILE | --replay FILE] [--verbose]
+ */
+
+#include <tyra>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "core/constants.hpp"
+#include "core/clock.hpp"
+#include "core/input.hpp"
+#include "core/profiler.hpp"
+#include "core/replay.hpp"
+#include "core/simulation.hpp"
+#include "world/room_generator.hpp"
+
+using namespace CanalUx;
+
+namespace {
+
+struct Options {
+    int frames;
+    unsigned int seed;
+    int startLevel;
+    bool skipToBoss;
+    bool verbose;
+    std::string recordPath;
+    std::string replayPath;
+
+    Options()
+        : frames(3600),
+          seed(1),
+          startLevel(Constants::Cheats::START_LEVEL > 0 ? Constants::Cheats::START_LEVEL : 1),
+          skipToBoss(Constants::Cheats::SKIP_TO_BOSS),
+          verbose(false) {}
+};
+
+struct RunStats {
+    int roomsEntered;
+    int deaths;
+    int bossesDefeated;
+    int levelLoads;
+    int peakMobs;
+    int peakProjectiles;
+    float totalMs;
+    float worstFrameMs;
+    int worstFrame;
+    float levelGenMs;
+    float phaseMs[Profiler::PHASE_COUNT];
+    uint32_t hash;
+
+    RunStats()
+        : roomsEntered(0), deaths(0), bossesDefeated(0), levelLoads(0),
+          peakMobs(0), peakProjectiles(0), totalMs(0.0f), worstFrameMs(0.0f),
+          worstFrame(0), levelGenMs(0.0f), phaseMs(), hash(2166136261u) {}
+};
+
+// FNV-1a over raw bytes - used to compare runs for determinism
+void hashBytes(uint32_t& hash, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+}
+
+void hashFloat(uint32_t& hash, float value) {
+    hashBytes(hash, &value, sizeof(value));
+}
+
+void hashInt(uint32_t& hash, int value) {
+    hashBytes(hash, &value, sizeof(value));
+}
+
+// Deterministic scripted input: wander in 8 directions, aim in a slow
+// rotating circle (fires whenever the cooldown allows), dive periodically,
+// and press Cross on the game over / victory screens to start again
+InputFrame makeScriptedInput(int frame, GameState state) {
+    static const int directions[8][2] = {
+        {128, 0}, {255, 0}, {255, 128}, {255, 255},
+        {128, 255}, {0, 255}, {0, 128}, {0, 0}
+    };
+    InputFrame input;
+    const int* dir = directions[(frame / 75) % 8];
+    input.leftH = static_cast<uint8_t>(dir[0]);
+    input.leftV = static_cast<uint8_t>(dir[1]);
+
+    float aimAngle = static_cast<float>(frame) * 0.05f;
+    input.rightH = static_cast<uint8_t>(128.0f + std::cos(aimAngle) * 127.0f);
+    input.rightV = static_cast<uint8_t>(128.0f + std::sin(aimAngle) * 127.0f);
+
+    input.setPressed(InputButton::R2, (frame % 240) < 40);
+    input.setPressed(InputButton::CROSS, state == GameState::GAME_OVER || state == GameState::VICTORY);
+    return input;
+}
+
+/**
+ * Drives the same Simulation as Game, minus rendering. Input comes from the
+ * script or from a replay file; run stats are inferred from state changes.
+ */
+class HostSimulation {
+public:
+    explicit HostSimulation(const Options& t_options) : options(t_options) {}
+
+    bool start() {
+        RunSettings settings;
+        settings.seed = options.seed;
+        settings.startLevel = options.startLevel;
+        settings.skipToBoss = options.skipToBoss;
+
+        if (!options.replayPath.empty()) {
+            if (!replayPlayer.open(options.replayPath)) {
+                std::fprintf(stderr, "Could not read replay %s\n", options.replayPath.c_str());
+                return false;
+            }
+            settings = replayPlayer.getSettings();
+        } else if (!options.recordPath.empty() && !recorder.open(options.recordPath, settings)) {
+            std::fprintf(stderr, "Could not write replay %s\n", options.recordPath.c_str());
+            return false;
+        }
+
+        simulation.setProfiler(&profiler);
+
+        Clock::Ticks start = Clock::now();
+        simulation.start(settings);
+        stats.levelGenMs += Clock::elapsedMs(start, Clock::now());
+        stats.levelLoads = simulation.getLevelLoads();
+        return true;
+    }
+
+    // Returns false once a replay runs out
+    bool step(int frame) {
+        profiler.beginFrame();
+
+        int steps = 1;
+        InputFrame input;
+        if (!options.replayPath.empty()) {
+            if (!replayPlayer.nextFrame(steps, input)) {
+                return false;
+            }
+        } else {
+            input = makeScriptedInput(frame, simulation.getState());
+        }
+        recorder.recordFrame(steps, input);
+
+        GameState stateBefore = simulation.getState();
+        int levelBefore = simulation.getCurrentLevelNumber();
+        int loadsBefore = simulation.getLevelLoads();
+        const Level* level = simulation.getCurrentLevel();
+        int gridX = level->getCurrentGridX();
+        int gridY = level->getCurrentGridY();
+
+        {
+            ProfileScope scope(&profiler, ProfilePhase::INPUT);
+            simulation.handleInput(input);
+        }
+        for (int i = 0; i < steps; i++) {
+            simulation.update(Constants::SIM_STEP_MS);
+            Tyra::Host::advanceTime(Constants::SIM_STEP_MS);
+        }
+
+        simulation.runIdleWork();
+        profiler.endFrame();
+        for (int i = 0; i < Profiler::PHASE_COUNT; i++) {
+            stats.phaseMs[i] += profiler.getLastPhaseMs(static_cast<ProfilePhase>(i));
+        }
+
+        recordTransitions(stateBefore, levelBefore, loadsBefore, gridX, gridY);
+        return true;
+    }
+
+    // Whether the last step loaded a level (its time counts as generation)
+    bool loadedLevel() const { return loadedThisStep; }
+
+    void hashFrame() {
+        const Player* player = simulation.getPlayer();
+        hashFloat(stats.hash, player->position.x);
+        hashFloat(stats.hash, player->position.y);
+        hashInt(stats.hash, player->getStats().getHealth());
+        hashInt(stats.hash, simulation.getMobManager().getMobCount());
+        hashInt(stats.hash, simulation.getProjectileManager().getCount());
+    }
+
+    void hashFinalState() {
+        const Level* level = simulation.getCurrentLevel();
+        hashInt(stats.hash, level->getLevelNumber());
+        hashInt(stats.hash, level->getCurrentGridX());
+        hashInt(stats.hash, level->getCurrentGridY());
+        for (const auto& mob : simulation.getMobManager().getMobs()) {
+            hashFloat(stats.hash, mob.position.x);
+            hashFloat(stats.hash, mob.position.y);
+            hashFloat(stats.hash, mob.health);
+        }
+        for (auto projectile : simulation.getProjectileManager().getProjectiles()) {
+            hashFloat(stats.hash, projectile.getPosition().x);
+            hashFloat(stats.hash, projectile.getPosition().y);
+        }
+    }
+
+    const RunSettings& getSettings() const { return simulation.getSettings(); }
+    const Profiler& getProfiler() const { return profiler; }
+    const Level* getLevel() const { return simulation.getCurrentLevel(); }
+    const ProjectilePoolStats& getProjectileStats() const { return simulation.getProjectileManager().getStats(); }
+    RunStats& getStats() { return stats; }
+
+private:
+    void recordTransitions(GameState stateBefore, int levelBefore, int loadsBefore, int gridX, int gridY) {
+        GameState state = simulation.getState();
+        const Level* level = simulation.getCurrentLevel();
+
+        stats.levelLoads = simulation.getLevelLoads();
+        loadedThisStep = simulation.getLevelLoads() != loadsBefore;
+
+        if (state == GameState::GAME_OVER && stateBefore != GameState::GAME_OVER) {
+            stats.deaths++;
+        }
+        if ((state == GameState::VICTORY && stateBefore != GameState::VICTORY) ||
+            (loadedThisStep && simulation.getCurrentLevelNumber() == levelBefore + 1)) {
+            stats.bossesDefeated++;
+        }
+        if (!loadedThisStep && (level->getCurrentGridX() != gridX || level->getCurrentGridY() != gridY)) {
+            stats.roomsEntered++;
+        }
+
+        stats.peakMobs = std::max(stats.peakMobs, simulation.getMobManager().getMobCount());
+        stats.peakProjectiles = std::max(stats.peakProjectiles,
+            simulation.getProjectileManager().getCount());
+    }
+
+    Options options;
+    RunStats stats;
+    bool loadedThisStep = false;
+
+    Simulation simulation;
+    Profiler profiler;
+    ReplayRecorder recorder;
+    ReplayPlayer replayPlayer;
+};
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--frames") == 0 && hasValue) {
+            options.frames = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--level") == 0 && hasValue) {
+            options.startLevel = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--boss") == 0) {
+            options.skipToBoss = true;
+        } else if (std::strcmp(arg, "--no-boss") == 0) {
+            options.skipToBoss = false;
+        } else if (std::strcmp(arg, "--record") == 0 && hasValue) {
+            options.recordPath = argv[++i];
+        } else if (std::strcmp(arg, "--replay") == 0 && hasValue) {
+            options.replayPath = argv[++i];
+        } else if (std::strcmp(arg, "--verbose") == 0) {
+            options.verbose = true;
+        } else {
+            std::fprintf(stderr, "Usage: %s [--frames N] [--seed S] [--level L] "
+                                 "[--boss|--no-boss] [--record FILE | --replay FILE] [--verbose]\n", argv[0]);
+            return false;
+        }
+    }
+
+    if (options.startLevel < 1 || options.startLevel > Constants::TOTAL_LEVELS) {
+        std::fprintf(stderr, "Level must be 1-%d\n", Constants::TOTAL_LEVELS);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+    Tyra::Host::setLogEnabled(options.verbose);
+
+    HostSimulation sim(options);
+    if (!sim.start()) {
+        return 1;
+    }
+
+    // A replay runs to its end rather than for a fixed frame count
+    bool replaying = !options.replayPath.empty();
+    RunStats& stats = sim.getStats();
+    int frame = 0;
+    for (; replaying || frame < options.frames; frame++) {
+        Clock::Ticks start = Clock::now();
+        if (!sim.step(frame)) {
+            break;
+        }
+        float frameMs = Clock::elapsedMs(start, Clock::now());
+
+        if (sim.loadedLevel()) {
+            stats.levelGenMs += frameMs;
+        }
+        stats.totalMs += frameMs;
+        if (frameMs > stats.worstFrameMs) {
+            stats.worstFrameMs = frameMs;
+            stats.worstFrame = frame;
+        }
+        sim.hashFrame();
+    }
+    sim.hashFinalState();
+
+    const RunSettings& settings = sim.getSettings();
+    std::printf("frames:           %d (seed %u, level %d%s%s)\n", frame, settings.seed,
+                settings.startLevel, settings.skipToBoss ? ", boss" : "", replaying ? ", replay" : "");
+    std::printf("sim time:         %.3f ms total, %.3f us/frame avg\n", stats.totalMs,
+                frame > 0 ? stats.totalMs * 1000.0f / frame : 0.0f);
+    std::printf("worst frame:      %.3f us (frame %d)\n", stats.worstFrameMs * 1000.0f, stats.worstFrame);
+    std::printf("level generation: %.3f ms over %d loads\n", stats.levelGenMs, stats.levelLoads);
+    std::printf("rooms entered:    %d\n", stats.roomsEntered);
+    std::printf("rooms generated:  %d of %d (final level)\n", sim.getLevel()->getGeneratedRoomCount(),
+                sim.getLevel()->getRoomCount());
+    std::printf("room templates:   %d shared tile maps\n", RoomGenerator::getTemplateCount());
+    std::printf("deaths:           %d\n", stats.deaths);
+    std::printf("bosses defeated:  %d\n", stats.bossesDefeated);
+    std::printf("peak mobs:        %d\n", stats.peakMobs);
+    std::printf("peak projectiles: %d\n", stats.peakProjectiles);
+    std::printf("projectile pool:  %d spawned, %d dropped (pool full)\n",
+                sim.getProjectileStats().spawned, sim.getProjectileStats().overflows);
+    std::printf("frame p99:        %.3f us (last %d frames)\n",
+                sim.getProfiler().getFramePercentileMs(0.99f) * 1000.0f, sim.getProfiler().getFrameCount());
+    for (int i = 0; i < Profiler::PHASE_COUNT; i++) {
+        ProfilePhase phase = static_cast<ProfilePhase>(i);
+        if (phase >= ProfilePhase::RENDER_ROOM) break;  // No rendering on host
+        std::printf("  %-15s %.3f us/frame avg\n", Profiler::getPhaseName(phase),
+                    frame > 0 ? stats.phaseMs[i] * 1000.0f / frame : 0.0f);
+    }
+    std::printf("state hash:       %08x\n", stats.hash);
+    return 0;
+}
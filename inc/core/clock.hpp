@@ -0,0 +1,48 @@
+/*
+ * CanalUx - Clock
+ * High resolution time source for frame timing
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#ifdef CANALUX_HOST
+#include <chrono>
+#endif
+
+namespace CanalUx {
+namespace Clock {
+
+#ifdef CANALUX_HOST
+
+// Native build - steady clock in nanoseconds
+using Ticks = uint64_t;
+constexpr float TICKS_PER_MS = 1000000.0f;
+
+inline Ticks now() {
+    return static_cast<Ticks>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+#else
+
+// EE COP0 Count register - increments once per CPU cycle (294.912 MHz)
+using Ticks = uint32_t;
+constexpr float TICKS_PER_MS = 294912.0f;
+
+inline Ticks now() {
+    Ticks count;
+    asm volatile("mfc0 %0, $9" : "=r"(count));
+    return count;
+}
+
+#endif
+
+// On PS2 the counter wraps roughly every 14.5 seconds, unsigned subtraction handles it
+inline float elapsedMs(Ticks start, Ticks end) {
+    return static_cast<float>(static_cast<Ticks>(end - start)) / TICKS_PER_MS;
+}
+
+}  // namespace Clock
+}  // namespace CanalUx
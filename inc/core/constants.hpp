@@ -21,7 +21,7 @@ constexpr int SCREEN_TILES_Y = 14;
 constexpr float PLAYER_SPEED = 1.0f;
 constexpr float PLAYER_SIZE = 32.0f;
 constexpr int PLAYER_MAX_HEALTH = 6;  // 3 hearts = 6 half-hearts
-constexpr float PLAYER_SHOOT_COOLDOWN = 5000.0f;
+constexpr float PLAYER_SHOOT_COOLDOWN = 5000.0f;  // Tyra timer ticks (see TIMER_TICKS_PER_MS)
 constexpr float PLAYER_SUBMERGE_DURATION = 3000.0f;  // Max time underwater
 constexpr float PLAYER_SUBMERGE_COOLDOWN = 5000.0f;  // Cooldown before can submerge again
 
@@ -29,6 +29,11 @@ constexpr float PLAYER_SUBMERGE_COOLDOWN = 5000.0f;  // Cooldown before can subm
 constexpr float PROJECTILE_SPEED = 1.25f;
 constexpr float PROJECTILE_SIZE = 16.0f;
 
+// Simulation clock - gameplay values are tuned per 60 Hz step
+constexpr float SIM_STEP_MS = 1000.0f / 60.0f;
+constexpr int SIM_MAX_STEPS_PER_FRAME = 4;  // Drop backlog beyond this instead of spiralling
+constexpr float TIMER_TICKS_PER_MS = 576.0f;  // Tyra::Timer runs at BUSCLK / 256
+
 // Physics
 constexpr float DRAG_COEFFICIENT = 0.2f;
 constexpr float VELOCITY_THRESHOLD = 0.01f;
@@ -44,6 +49,15 @@ constexpr int LEVEL_GRID_HEIGHT = 8;
 constexpr int MIN_ROOMS_PER_LEVEL = 6;
 constexpr int MAX_ROOMS_PER_LEVEL = 12;
 
+// Lazy room generation - only the layout is built when a level starts, each
+// room's tiles are generated when it is first needed
+constexpr bool LAZY_ROOM_GENERATION = true;
+constexpr int ROOMS_GENERATED_PER_IDLE_FRAME = 1;  // Neighbours of the current room, 0 = on demand only
+
+// Per-frame time slice for building the next level during the boss fight
+// and tearing the previous one down afterwards
+constexpr float LEVEL_BACKGROUND_BUDGET_MS = 1.0f;
+
 // Boss room sizes per level
 // Level 1 - Pike: Large open water arena for swimming
 constexpr int PIKE_ROOM_WIDTH = 24;
@@ -69,6 +83,11 @@ constexpr int NANNY_MIN_GAPS_2 = 1;    // Minimum gaps in stream (gauntlet 2 - h
 // Game progression
 constexpr int TOTAL_LEVELS = 3;  // 3 canal sections to escape
 
+// Enemy projectile pool size per level, allocated when the level loads and
+// sized for its boss (the Lock Keeper's shockwave rings keep 1200+ shots alive)
+constexpr int PROJECTILE_POOL_CAPACITY[TOTAL_LEVELS] = {256, 1536, 384};
+constexpr int PLAYER_PROJECTILE_CAPACITY = 128;  // Player shots have their own pool (peak ~80)
+
 // Mob defaults
 constexpr float MOB_BASE_SPEED = 0.025f;
 
@@ -121,5 +140,18 @@ namespace Cheats {
     constexpr float SPEED_MULTIPLIER = 1.0f;  // Set to 2.0f for double speed
 }
 
+// ============================================
+// INPUT REPLAY - Set both to false for release!
+// ============================================
+namespace Replay {
+    // Record the run seed and per-frame input to FILENAME
+    constexpr bool RECORD = false;
+    
+    // Play FILENAME back instead of reading the pad (takes priority over RECORD)
+    constexpr bool PLAYBACK = false;
+    
+    constexpr const char* FILENAME = "replay.cxr";
+}
+
 }  // namespace Constants
 }  // namespace CanalUx
\ No newline at end of file
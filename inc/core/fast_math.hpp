@@ -0,0 +1,95 @@
+/*
+ * CanalUx - Fast Math
+ * Approximate sin/cos, atan2, sqrt and reciprocal sqrt for gameplay and
+ * wobble code. newlib's sinf/cosf/atan2f are software routines costing
+ * hundreds of cycles on the EE; these are a table lookup or a short
+ * polynomial, and sqrt/rsqrt map to single COP1 instructions.
+ *
+ * Accuracy (checked by canalux_bench): sin/cos within 1e-4, atan2 within
+ * 2e-5 rad, rsqrt within 1e-5 relative on the host. Good for aiming and
+ * animation, not for anything that accumulates error over many steps.
+ */
+
+#pragma once
+
+#include <cmath>
+
+namespace CanalUx {
+namespace FastMath {
+
+constexpr float PI = 3.14159265f;
+constexpr float HALF_PI = 1.57079633f;
+constexpr float TWO_PI = 6.28318531f;
+
+// One full turn of sine, plus a copy of the first entry so interpolation
+// never wraps. Power of two so angles wrap with a mask.
+constexpr int SIN_TABLE_SIZE = 256;
+extern float sinTable[SIN_TABLE_SIZE + 1];
+
+// Sine and cosine of the same angle (radians, any sign) in one lookup
+inline void sinCos(float angle, float& outSin, float& outCos) {
+    float t = angle * (SIN_TABLE_SIZE / TWO_PI);
+    int i = static_cast<int>(t);
+    if (t < i) i--;  // Round toward negative infinity
+    float f = t - i;
+
+    int s = i & (SIN_TABLE_SIZE - 1);
+    int c = (i + SIN_TABLE_SIZE / 4) & (SIN_TABLE_SIZE - 1);
+    outSin = sinTable[s] + (sinTable[s + 1] - sinTable[s]) * f;
+    outCos = sinTable[c] + (sinTable[c + 1] - sinTable[c]) * f;
+}
+
+inline float sin(float angle) {
+    float s, c;
+    sinCos(angle, s, c);
+    return s;
+}
+
+inline float cos(float angle) {
+    float s, c;
+    sinCos(angle, s, c);
+    return c;
+}
+
+// Same conventions as std::atan2: angle of (x, y) in [-PI, PI]
+inline float atan2(float y, float x) {
+    float ax = std::fabs(x);
+    float ay = std::fabs(y);
+    float maxValue = ax > ay ? ax : ay;
+    float minValue = ax > ay ? ay : ax;
+    if (maxValue == 0.0f) return 0.0f;
+
+    // Polynomial for atan on [0, 1] (Abramowitz & Stegun 4.4.49, error
+    // below 1e-5), then unfold the octant
+    float a = minValue / maxValue;
+    float s = a * a;
+    float r = ((((0.0208351f * s - 0.0851330f) * s + 0.1801410f) * s - 0.3302995f) * s + 0.9998660f) * a;
+    if (ay > ax) r = HALF_PI - r;
+    if (x < 0.0f) r = PI - r;
+    if (y < 0.0f) r = -r;
+    return r;
+}
+
+inline float sqrt(float x) {
+#ifdef CANALUX_HOST
+    return std::sqrt(x);
+#else
+    float result;
+    asm("sqrt.s %0, %1" : "=f"(result) : "f"(x));
+    return result;
+#endif
+}
+
+// 1 / sqrt(x), x > 0
+inline float rsqrt(float x) {
+#ifdef CANALUX_HOST
+    return 1.0f / std::sqrt(x);
+#else
+    float result;
+    asm("rsqrt.s %0, %1, %2" : "=f"(result) : "f"(1.0f), "f"(x));
+    return result;
+#endif
+}
+
+}  // namespace FastMath
+}  // namespace CanalUx
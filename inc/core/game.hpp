@@ -6,28 +6,19 @@
 #pragma once
 
 #include <tyra>
-#include <memory>
 #include "core/constants.hpp"
 #include "core/camera.hpp"
-#include "world/level.hpp"
-#include "entities/player.hpp"
-#include "managers/projectile_manager.hpp"
-#include "managers/mob_manager.hpp"
-#include "managers/collision_manager.hpp"
+#include "core/sim_clock.hpp"
+#include "core/input.hpp"
+#include "core/profiler.hpp"
+#include "core/replay.hpp"
+#include "core/simulation.hpp"
 #include "rendering/room_renderer.hpp"
 #include "rendering/entity_renderer.hpp"
 #include "rendering/hud_renderer.hpp"
 
 namespace CanalUx {
 
-enum class GameState {
-    MENU,
-    PLAYING,
-    PAUSED,
-    GAME_OVER,
-    VICTORY
-};
-
 class Game : public Tyra::Game {
 public:
     explicit Game(Tyra::Engine* engine);
@@ -38,52 +29,41 @@ public:
 
     // Accessors
     Tyra::Engine* getEngine() { return engine; }
-    GameState getState() const { return state; }
-    int getCurrentLevelNumber() const { return currentLevelNumber; }
+    GameState getState() const { return simulation.getState(); }
+    int getCurrentLevelNumber() const { return simulation.getCurrentLevelNumber(); }
 
 private:
     // Lifecycle
     void initRenderers();
     void cleanupRenderers();
-    void initLevel(int levelNumber);
 
     // Game loop phases
-    void handleInput();
-    void update();
-    void render();
-
-    // Room transition logic
-    void checkRoomTransitions();
-    void onRoomEnter();
-
-    // State transitions
-    void setState(GameState newState);
-    void startNewGame();
-    void advanceToNextLevel();
-    void onPlayerDeath();
-    void onBossDefeated();
-    void onLevelComplete();
+    int readInput();
+    void render(float alpha);
+    void renderWorld(float alpha);  // Room, entities and HUD
 
     // Core engine reference
     Tyra::Engine* engine;
 
-    // Game state
-    GameState state;
-    int currentLevelNumber;
+    // Gameplay state (level, entities, managers, state machine)
+    Simulation simulation;
 
-    // Camera
-    Camera camera;
+    // Fixed-timestep simulation clock
+    SimClock simClock;
 
-    // Level
-    std::unique_ptr<Level> currentLevel;
+    // Controller state applied to this frame's steps
+    InputFrame input;
 
-    // Entities
-    std::unique_ptr<Player> player;
+    // Input recording / playback (see Constants::Replay)
+    ReplayRecorder recorder;
+    ReplayPlayer replayPlayer;
 
-    // Managers
-    ProjectileManager projectileManager;
-    MobManager mobManager;
-    CollisionManager collisionManager;
+    // Per-phase frame timing, shown when Cheats::SHOW_DEBUG_INFO is on
+    Profiler profiler;
+    Profiler* activeProfiler;  // &profiler when enabled, otherwise nullptr
+
+    // Camera
+    Camera camera;
 
     // Renderers
     RoomRenderer roomRenderer;
@@ -91,4 +71,4 @@ private:
     HUDRenderer hudRenderer;
 };
 
-}  // namespace CanalUx
\ No newline at end of file
+}  // namespace CanalUx
@@ -0,0 +1,72 @@
+/*
+ * CanalUx - Input Frame
+ * Snapshot of the controller state the game reads each frame.
+ * Gameplay reads this instead of Tyra::Pad so input can be recorded and replayed.
+ */
+
+#pragma once
+
+#include <tyra>
+#include <cstdint>
+
+namespace CanalUx {
+
+// Buttons the game responds to (bit flags)
+enum class InputButton : uint16_t {
+    CROSS    = 1 << 0,
+    TRIANGLE = 1 << 1,
+    START    = 1 << 2,
+    R2       = 1 << 3
+};
+
+struct InputFrame {
+    // Analog sticks (0-255, 128 = centred) - same ranges as Tyra::Pad
+    uint8_t leftH;
+    uint8_t leftV;
+    uint8_t rightH;
+    uint8_t rightV;
+
+    // Held buttons (InputButton bits)
+    uint16_t buttons;
+
+    InputFrame() : leftH(128), leftV(128), rightH(128), rightV(128), buttons(0) {}
+
+    bool isPressed(InputButton button) const {
+        return (buttons & static_cast<uint16_t>(button)) != 0;
+    }
+
+    void setPressed(InputButton button, bool pressed) {
+        if (pressed) {
+            buttons |= static_cast<uint16_t>(button);
+        } else {
+            buttons &= ~static_cast<uint16_t>(button);
+        }
+    }
+
+    bool operator==(const InputFrame& other) const {
+        return leftH == other.leftH && leftV == other.leftV &&
+               rightH == other.rightH && rightV == other.rightV &&
+               buttons == other.buttons;
+    }
+    bool operator!=(const InputFrame& other) const { return !(*this == other); }
+
+    // Sample the live controller
+    static InputFrame fromPad(Tyra::Pad& pad) {
+        InputFrame frame;
+        const auto& leftJoy = pad.getLeftJoyPad();
+        const auto& rightJoy = pad.getRightJoyPad();
+        const auto& pressed = pad.getPressed();
+
+        frame.leftH = leftJoy.h;
+        frame.leftV = leftJoy.v;
+        frame.rightH = rightJoy.h;
+        frame.rightV = rightJoy.v;
+        frame.setPressed(InputButton::CROSS, pressed.Cross);
+        frame.setPressed(InputButton::TRIANGLE, pressed.Triangle);
+        frame.setPressed(InputButton::START, pressed.Start);
+        frame.setPressed(InputButton::R2, pressed.R2);
+        return frame;
+    }
+};
+
+}  // namespace CanalUx
@@ -0,0 +1,93 @@
+/*
+ * CanalUx - Frame Profiler
+ * Lightweight per-phase timers for the game loop. Each frame's phase times
+ * are kept in a rolling window for the debug overlay and host tools.
+ */
+
+#pragma once
+
+#include <array>
+#include "core/clock.hpp"
+
+namespace CanalUx {
+
+enum class ProfilePhase {
+    INPUT,
+    PLAYER,
+    PROJECTILES,
+    MOBS,
+    COLLISIONS,
+    ROOM_CLEAR,
+    TRANSITIONS,
+    RENDER_ROOM,
+    RENDER_ENTITIES,
+    RENDER_HUD,
+    COUNT
+};
+
+class Profiler {
+public:
+    static constexpr int PHASE_COUNT = static_cast<int>(ProfilePhase::COUNT);
+    static constexpr int HISTORY_FRAMES = 120;  // 2 seconds at 60 fps
+
+    Profiler();
+    ~Profiler();
+
+    // Frame boundaries - phase times between these belong to one frame
+    void beginFrame();
+    void endFrame();
+
+    // Add time to a phase of the current frame (phases may run several
+    // times a frame, e.g. once per simulation step)
+    void addPhaseTime(ProfilePhase phase, float ms) { current[static_cast<int>(phase)] += ms; }
+
+    static const char* getPhaseName(ProfilePhase phase);
+
+    // Rolling window statistics
+    int getFrameCount() const { return frameCount; }
+    float getPhaseAverageMs(ProfilePhase phase) const;
+    float getFrameMinMs() const;
+    float getFrameAverageMs() const;
+    float getFramePercentileMs(float percentile) const;
+    float getLastFrameMs() const;
+    float getLastPhaseMs(ProfilePhase phase) const;
+
+private:
+    struct FrameSample {
+        std::array<float, PHASE_COUNT> phaseMs;
+        float totalMs;
+    };
+
+    std::array<float, PHASE_COUNT> current;
+    Clock::Ticks frameStart;
+
+    std::array<FrameSample, HISTORY_FRAMES> history;
+    int historyIndex;  // Next slot to write
+    int frameCount;    // Valid samples (up to HISTORY_FRAMES)
+};
+
+/**
+ * Times its own lifetime into a phase. A null profiler makes this a no-op,
+ * so instrumented code costs nothing when profiling is off.
+ */
+class ProfileScope {
+public:
+    ProfileScope(Profiler* t_profiler, ProfilePhase t_phase)
+        : profiler(t_profiler), phase(t_phase), start(t_profiler ? Clock::now() : 0) {}
+
+    ~ProfileScope() {
+        if (profiler) {
+            profiler->addPhaseTime(phase, Clock::elapsedMs(start, Clock::now()));
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler* profiler;
+    ProfilePhase phase;
+    Clock::Ticks start;
+};
+
+}  // namespace CanalUx
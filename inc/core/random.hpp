@@ -0,0 +1,80 @@
+/*
+ * CanalUx - Random
+ * Small deterministic random number generator. A run has a single seed;
+ * every consumer draws from its own stream derived from it (run -> level ->
+ * room -> mob), so what one system draws never shifts another's numbers
+ * and a replay reproduces everything from the seed alone.
+ *
+ * Counter based: the state is a 32-bit counter and each number is a hash
+ * of it, so a stream costs one word and a draw a few integer ops (no
+ * libc state, no 64-bit math).
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace CanalUx {
+
+class Random {
+public:
+    explicit Random(uint32_t seed = 0) : counter(seed) {}
+
+    // Seed of child stream 'stream' of a seed (a level of a run, a room of
+    // a level, a mob of a room). Same inputs, same seed, on every platform.
+    static uint32_t deriveSeed(uint32_t seed, uint32_t stream) {
+        return mix(seed ^ mix(stream + 0x632BE5ABu));
+    }
+
+    // Next 32 random bits
+    uint32_t next() {
+        counter += 0x9E3779B9u;
+        return mix(counter);
+    }
+
+    // Integer in [0, count) (count > 0)
+    int nextInt(int count) {
+        return static_cast<int>((static_cast<uint64_t>(next()) * static_cast<uint32_t>(count)) >> 32);
+    }
+
+    // Integer in [minValue, maxValue], both inclusive
+    int nextInt(int minValue, int maxValue) {
+        return minValue + nextInt(maxValue - minValue + 1);
+    }
+
+    // Float in [0, 1)
+    float nextFloat() {
+        return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Float in [minValue, maxValue)
+    float nextFloat(float minValue, float maxValue) {
+        return minValue + nextFloat() * (maxValue - minValue);
+    }
+
+    // Fisher-Yates - unlike std::shuffle the order is the same on every
+    // standard library
+    template <typename T>
+    void shuffle(std::vector<T>& items) {
+        for (int i = static_cast<int>(items.size()) - 1; i > 0; i--) {
+            std::swap(items[i], items[nextInt(i + 1)]);
+        }
+    }
+
+private:
+    // 32-bit integer hash (lowbias32)
+    static uint32_t mix(uint32_t x) {
+        x ^= x >> 16;
+        x *= 0x7FEB352Du;
+        x ^= x >> 15;
+        x *= 0x846CA68Bu;
+        x ^= x >> 16;
+        return x;
+    }
+
+    uint32_t counter;
+};
+
+}  // namespace CanalUx
@@ -0,0 +1,78 @@
+/*
+ * CanalUx - Input Replay
+ * Records the run settings and every frame's input to a file, and plays it
+ * back. The simulation only reads InputFrame and seeded RNGs, so a replay
+ * reproduces the run exactly.
+ *
+ * File layout (little-endian):
+ *   header: "CXRP" magic (u32), version (u16), start level (u8),
+ *           skip to boss (u8), seed (u32)
+ *   runs:   frame count (u16), sim steps (u8), left h/v, right h/v (4 x u8),
+ *           buttons (u16) - consecutive identical frames are merged into one run
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "core/input.hpp"
+#include "core/simulation.hpp"
+
+namespace CanalUx {
+
+class ReplayRecorder {
+public:
+    ReplayRecorder();
+    ~ReplayRecorder();
+
+    bool open(const std::string& path, const RunSettings& settings);
+    void close();
+
+    // Record one rendered frame: the number of simulation steps it ran and
+    // the input applied to them
+    void recordFrame(int steps, const InputFrame& input);
+
+    bool isRecording() const { return file != nullptr; }
+
+private:
+    void flushRun();
+
+    FILE* file;
+
+    // Current run of identical frames
+    InputFrame runInput;
+    uint8_t runSteps;
+    uint16_t runLength;
+    int runsSinceFlush;
+};
+
+class ReplayPlayer {
+public:
+    ReplayPlayer();
+    ~ReplayPlayer();
+
+    bool open(const std::string& path);
+    void close();
+
+    // Settings to start the simulation with
+    const RunSettings& getSettings() const { return settings; }
+
+    // Next recorded frame. Returns false (and closes the file) once the
+    // replay is exhausted.
+    bool nextFrame(int& steps, InputFrame& input);
+
+    bool isPlaying() const { return file != nullptr; }
+
+private:
+    bool readRun();
+
+    FILE* file;
+    RunSettings settings;
+
+    InputFrame runInput;
+    uint8_t runSteps;
+    uint16_t runRemaining;
+};
+
+}  // namespace CanalUx
@@ -0,0 +1,41 @@
+/*
+ * CanalUx - Simulation Clock
+ * Fixed timestep accumulator that decouples game speed from render rate
+ */
+
+#pragma once
+
+#include "core/clock.hpp"
+#include "core/constants.hpp"
+
+namespace CanalUx {
+
+class SimClock {
+public:
+    SimClock();
+    ~SimClock();
+
+    // Forget accumulated time (call after long stalls such as level loads)
+    void reset();
+
+    // Sample real time and return how many fixed steps to simulate this frame
+    int beginFrame();
+
+    // Length of one simulation step in milliseconds
+    float getStepMs() const { return stepMs; }
+
+    // How far between the last two simulation states to render (0-1)
+    float getAlpha() const { return accumulator / stepMs; }
+
+    // Real time taken by the last frame (ms)
+    float getFrameMs() const { return frameMs; }
+
+private:
+    Clock::Ticks lastTicks;
+    float stepMs;
+    float accumulator;
+    float frameMs;
+    bool primed;
+};
+
+}  // namespace CanalUx
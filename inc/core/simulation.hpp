@@ -0,0 +1,132 @@
+/*
+ * CanalUx - Simulation
+ * The gameplay side of Game: level, player, managers and the game state machine.
+ * Has no rendering or engine dependency, so the same code runs on the PS2,
+ * in the host harness and during replays.
+ */
+
+#pragma once
+
+#include <tyra>
+#include <memory>
+#include "core/constants.hpp"
+#include "core/input.hpp"
+#include "core/profiler.hpp"
+#include "world/level.hpp"
+#include "entities/player.hpp"
+#include "managers/projectile_manager.hpp"
+#include "managers/mob_manager.hpp"
+#include "managers/collision_manager.hpp"
+
+namespace CanalUx {
+
+enum class GameState {
+    MENU,
+    PLAYING,
+    PAUSED,
+    GAME_OVER,
+    VICTORY
+};
+
+/**
+ * Everything needed to reproduce a run. Level seeds are derived from the run
+ * seed and the number of levels loaded so far.
+ */
+struct RunSettings {
+    unsigned int seed;
+    int startLevel;
+    bool skipToBoss;
+
+    RunSettings();
+};
+
+class Simulation {
+public:
+    Simulation();
+    ~Simulation();
+
+    // Start a run (generates the first level)
+    void start(const RunSettings& settings);
+
+    // Apply this frame's input - state changes (pause, restart) and the
+    // controller state the player reads during update()
+    void handleInput(const InputFrame& input);
+
+    // Advance one fixed simulation step (deltaTime in ms)
+    void update(float deltaTime);
+
+    // Once per rendered frame: background work that doesn't affect the
+    // simulation's outcome - pre-generating rooms next to the player,
+    // building the next level during the boss fight and tearing down the
+    // previous one, within Constants::LEVEL_BACKGROUND_BUDGET_MS
+    void runIdleWork();
+
+    // Snap interpolation history after teleports (room change, level load)
+    void snapPreviousPositions();
+
+    // Time update phases into this profiler (nullptr to disable)
+    void setProfiler(Profiler* t_profiler) { profiler = t_profiler; }
+
+    // Entropy-based seed for live runs
+    static unsigned int makeRandomSeed();
+
+    // Accessors
+    GameState getState() const { return state; }
+    int getCurrentLevelNumber() const { return currentLevelNumber; }
+    int getLevelLoads() const { return levelLoads; }
+    const RunSettings& getSettings() const { return settings; }
+    Level* getCurrentLevel() { return currentLevel.get(); }
+    const Level* getCurrentLevel() const { return currentLevel.get(); }
+    Player* getPlayer() { return player.get(); }
+    const Player* getPlayer() const { return player.get(); }
+    ProjectileManager& getProjectileManager() { return projectileManager; }
+    const ProjectileManager& getProjectileManager() const { return projectileManager; }
+    MobManager& getMobManager() { return mobManager; }
+    const MobManager& getMobManager() const { return mobManager; }
+
+private:
+    void initLevel(int levelNumber);
+    unsigned int levelSeedForLoad(int loadIndex) const;
+    void retireLevel(std::unique_ptr<Level>& level);
+
+    // Room transition logic
+    void checkRoomTransitions();
+    void onRoomEnter();
+
+    // State transitions
+    void setState(GameState newState);
+    void startNewGame();
+    void advanceToNextLevel();
+    void onPlayerDeath();
+    void onBossDefeated();
+    void onLevelComplete();
+
+    // Run configuration
+    RunSettings settings;
+    int levelLoads;
+
+    // Game state
+    GameState state;
+    int currentLevelNumber;
+
+    // Controller state for the current frame (read by Player)
+    InputFrame input;
+
+    // Optional phase timing (not owned)
+    Profiler* profiler;
+
+    // Level
+    std::unique_ptr<Level> currentLevel;
+    std::unique_ptr<Level> pendingLevel;  // Next level, built in the background
+    std::unique_ptr<Level> retiredLevel;  // Previous level, released in the background
+
+    // Entities
+    std::unique_ptr<Player> player;
+
+    // Managers
+    ProjectileManager projectileManager;
+    MobManager mobManager;
+    CollisionManager collisionManager;
+};
+
+}  // namespace CanalUx
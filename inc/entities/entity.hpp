@@ -26,6 +26,10 @@ public:
     void applyDrag(float dragCoefficient = Constants::DRAG_COEFFICIENT);
     void clampVelocity(float maxVel = Constants::MAX_VELOCITY);
 
+    // Render interpolation - previousPosition is the state at the start of the step
+    void storePreviousPosition() { previousPosition = position; }
+    Tyra::Vec2 getInterpolatedPosition(float alpha) const;
+
     // Bounding box helpers
     float getLeft() const { return position.x; }
     float getRight() const { return position.x + size.x / Constants::TILE_SIZE; }
@@ -43,6 +47,7 @@ public:
 
     // Core data - public for easy access
     Tyra::Vec2 position;
+    Tyra::Vec2 previousPosition;
     Tyra::Vec2 velocity;
     Tyra::Vec2 size;
     bool active;
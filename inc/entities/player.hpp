@@ -8,6 +8,7 @@
 #include <tyra>
 #include "entities/entity.hpp"
 #include "components/stats.hpp"
+#include "core/input.hpp"
 
 namespace CanalUx {
 
@@ -17,17 +18,18 @@ class ProjectileManager;
 
 class Player : public Entity {
 public:
-    explicit Player(Tyra::Pad* pad);
+    // input is owned by the caller and refreshed every frame
+    explicit Player(const InputFrame* input);
     ~Player();
 
-    // Main update - called every frame
+    // Main update - called every simulation step (deltaTime in ms)
     void update(float deltaTime);
 
     // Player-specific update with dependencies
-    void update(Room* currentRoom, ProjectileManager* projectileManager);
+    void update(Room* currentRoom, ProjectileManager* projectileManager, float deltaTime);
     
     // Simplified update (no shooting)
-    void update(Room* currentRoom);
+    void update(Room* currentRoom, float deltaTime);
 
     // Combat
     void takeDamage(int amount);
@@ -55,16 +57,17 @@ private:
     void handleSubmergeInput();
     void updateSubmergeState(float deltaTime);
     void updateInvincibility(float deltaTime);
+    void updateShootCooldown(float deltaTime);
     // Note: World collision now handled by CollisionManager
 
     // Input
-    Tyra::Pad* pad;
+    const InputFrame* input;
 
     // Player stats (health, damage, speed modifiers)
     Stats stats;
 
-    // Timers
-    Tyra::Timer shootTimer;
+    // Timers (ms of simulation time)
+    float shootCooldownRemaining;
     float submergeTimeRemaining;
     float submergeCooldownRemaining;
     float invincibilityTimeRemaining;
@@ -1,6 +1,7 @@
 /*
  * CanalUx - Projectile Class
- * Represents a single projectile (player tears or enemy shots)
+ * Describes a single projectile (player tears or enemy shots) - what gets
+ * spawned. Live projectiles are stored and moved by ProjectileManager.
  */
 
 #pragma once
@@ -25,12 +26,6 @@ public:
     Projectile(Tyra::Vec2 pos, Tyra::Vec2 vel, float dmg, bool fromPlayer);
     ~Projectile();
 
-    // Update methods
-    void update(float deltaTime);
-
-    // Update with room for collision
-    void update(Room* currentRoom);
-
     // Properties
     bool isFromPlayer() const { return fromPlayer; }
     float getDamage() const { return damage; }
@@ -42,6 +37,7 @@ public:
     void setAcceleration(float accel) { acceleration = accel; }
     float getAcceleration() const { return acceleration; }
     void setMaxSpeed(float speed) { maxSpeed = speed; }
+    float getMaxSpeed() const { return maxSpeed; }
     
     // Submerged hitting - barges hit even when player is submerged
     void setHitsSubmerged(bool hits) { hitsSubmerged = hits; }
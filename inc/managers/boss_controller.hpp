@@ -0,0 +1,46 @@
+/*
+ * CanalUx - Boss Controller
+ * Base for the per-boss controllers (PikeBoss, LockKeeperBoss, NannyBoss).
+ * A controller owns everything its boss remembers between frames beyond
+ * the common MobData fields, plus the update logic that uses it. Only one
+ * boss is ever in a room, so MobManager keeps one of each and calls the
+ * right one directly - no virtual dispatch, no allocation. Every
+ * controller's update takes the same arguments:
+ *   update(mob, room, player, projectileManager, sightCache, stepFrames)
+ */
+
+#pragma once
+
+#include "managers/mob_data.hpp"
+
+namespace CanalUx {
+
+class Room;
+class Player;
+class ProjectileManager;
+class SightCache;
+
+class BossController {
+public:
+    int getPhase() const { return phase; }
+
+protected:
+    BossController() : phase(1) {}
+
+    // Phase from the boss's health: 2 at or below phase2Health of its
+    // maximum, 3 at or below phase3Health
+    void updatePhase(const MobData& mob, float phase2Health, float phase3Health) {
+        float healthPercent = mob.health / mob.maxHealth;
+        if (healthPercent <= phase3Health) {
+            phase = 3;
+        } else if (healthPercent <= phase2Health) {
+            phase = 2;
+        } else {
+            phase = 1;
+        }
+    }
+
+    int phase;  // Changes behavior at health thresholds
+};
+
+}  // namespace CanalUx
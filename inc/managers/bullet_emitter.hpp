@@ -0,0 +1,112 @@
+/*
+ * CanalUx - Bullet Emitter
+ * Data-driven bullet patterns for boss attacks. A BulletPattern describes
+ * one volley (shape, bullet count, spread, speed and what the shots are);
+ * a BulletEmitter turns it into a table of per-bullet velocities and
+ * offsets once, then each fire only rotates that table onto the aim - one
+ * sin/cos per volley instead of per bullet - and hands the whole volley to
+ * ProjectileManager in one call.
+ *
+ * Tables are in the aim's frame: x along the aim, y to its side.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <tyra>
+#include "entities/projectile.hpp"
+
+namespace CanalUx {
+
+class ProjectileManager;
+
+enum class BulletShape : uint8_t {
+    RING,          // Evenly around the full circle, starting on the aim
+    ARC,           // Fanned evenly across 'spread' radians, centred on the aim
+    SPIRAL,        // A ring that turns by 'spin' radians every fire
+    AIMED_VOLLEY,  // All along the aim, drifting apart sideways by 'spread' (tiles/frame) per bullet
+    WAVE           // A row 'spread' tiles wide across the aim, all flying along it
+};
+
+struct BulletPattern {
+    BulletShape shape;
+    int count;          // Bullets per volley
+    float spread;       // Meaning depends on shape (see BulletShape)
+    float spin;         // SPIRAL: turn per fire (radians)
+    float speed;        // Tiles per 60 Hz frame
+    float spawnRadius;  // Bullets start this far out from the origin (tiles)
+
+    // What each bullet is
+    float damage;
+    float maxRange;      // Tiles
+    float acceleration;  // Speed gain per frame (0 = constant speed)
+    float maxSpeed;
+
+    BulletPattern()
+        : shape(BulletShape::RING), count(1), spread(0), spin(0), speed(0.05f), spawnRadius(0),
+          damage(1.0f), maxRange(10.0f), acceleration(0), maxSpeed(1.0f) {}
+
+    static BulletPattern ring(int count, float speed);
+    static BulletPattern arc(int count, float spread, float speed);
+    static BulletPattern spiral(int count, float spin, float speed);
+    static BulletPattern aimedVolley(int count, float sideSpeed, float speed);
+    static BulletPattern wave(int count, float width, float speed);
+};
+
+class BulletEmitter {
+public:
+    BulletEmitter();
+    explicit BulletEmitter(const BulletPattern& pattern);
+
+    // Change the pattern. The tables are only rebuilt when the volley's
+    // shape changes (shape, count, spread or speed), so setting a pattern
+    // every fire costs a compare. Ring and spiral directions are kept per
+    // bullet count: a count's first volley works them out (one sin/cos per
+    // bullet), later ones only rescale them - see prepareRings.
+    void setPattern(const BulletPattern& pattern);
+    const BulletPattern& getPattern() const { return pattern; }
+
+    // Make room for volleys of up to maxCount bullets (tables and cached
+    // ring directions), so firing never allocates afterwards
+    void reserve(int maxCount);
+
+    // Work out ring and spiral directions for every count from minCount to
+    // maxCount now, so a ring that changes count between volleys never
+    // calls sin/cos mid-fight
+    void prepareRings(int minCount, int maxCount);
+
+    // Fire one volley from origin along a unit aim direction, or at an
+    // angle (radians). Returns how many bullets the pool took.
+    int fire(ProjectileManager* projectileManager, const Tyra::Vec2& origin, const Tyra::Vec2& aim);
+    int fire(ProjectileManager* projectileManager, const Tyra::Vec2& origin, float angle);
+
+    // SPIRAL: how far the pattern has turned, and turning it back to 0
+    float getSpinAngle() const { return spinAngle; }
+    void resetSpin() { spinAngle = 0; }
+
+private:
+    void buildPrototype();
+    void buildTables();
+    void advanceSpin();
+
+    // Unit directions of an even ring of count bullets, worked out the
+    // first time that count is fired
+    const Tyra::Vec2* ringDirections(int count);
+
+    // Rotate the tables by (cosAim, sinAim), then spawn
+    int emit(ProjectileManager* projectileManager, const Tyra::Vec2& origin, float cosAim, float sinAim);
+
+    BulletPattern pattern;
+    Projectile prototype;                     // Everything the bullets share
+    std::vector<Tyra::Vec2> directions;       // Per bullet, aim frame: unit, outward
+    std::vector<Tyra::Vec2> velocities;       // Per bullet, aim frame
+    std::vector<Tyra::Vec2> offsets;          // Per bullet, aim frame, before spawnRadius
+    std::vector<Tyra::Vec2> spawnPositions;   // Scratch for one volley
+    std::vector<Tyra::Vec2> spawnVelocities;
+    std::vector<Tyra::Vec2> ringCache;        // Ring of n bullets at n * (n - 1) / 2
+    std::vector<uint8_t> ringCached;          // Per count, 1 once its ring is in ringCache
+    float spinAngle;
+};
+
+}  // namespace CanalUx
@@ -8,24 +8,25 @@
 #include <tyra>
 #include "core/constants.hpp"
 #include "managers/mob_manager.hpp"
+#include "managers/projectile_manager.hpp"
+#include "managers/spatial_grid.hpp"
 
 namespace CanalUx {
 
 class Player;
 class Room;
-class ProjectileManager;
-class Projectile;
 
 class CollisionManager {
 public:
     CollisionManager();
     ~CollisionManager();
 
-    // === Main update - call once per frame ===
+    // === Main update - call once per simulation step (deltaTime in ms) ===
     void checkCollisions(Player* player, 
                          MobManager* mobManager,
                          ProjectileManager* projectileManager,
-                         Room* currentRoom);
+                         Room* currentRoom,
+                         float deltaTime);
 
     // === World collision (tiles + obstacles) ===
     
@@ -36,12 +37,12 @@ public:
     void resolveMobWorldCollision(MobManager::MobData& mob, Room* room);
     
     // Check projectile collision with world (destroys projectile if hit)
-    void checkProjectileWorldCollision(Projectile& projectile, Room* room, bool isPlayerProjectile);
+    void checkProjectileWorldCollision(ProjectileRef projectile, Room* room, bool isPlayerProjectile);
 
 private:
     // === Entity vs Entity collisions ===
     void checkPlayerMobCollisions(Player* player, MobManager* mobManager);
-    void checkProjectileMobCollisions(ProjectileManager* projectileManager, MobManager* mobManager);
+    void checkProjectileMobCollisions(ProjectileManager* projectileManager, MobManager* mobManager, Room* room);
     void checkProjectilePlayerCollisions(ProjectileManager* projectileManager, Player* player);
     
     // === World collision helpers ===
@@ -58,6 +59,11 @@ private:
     // Helper: AABB collision check
     bool checkAABB(const Tyra::Vec2& pos1, const Tyra::Vec2& size1,
                    const Tyra::Vec2& pos2, const Tyra::Vec2& size2) const;
+    
+    float stepFrames;  // Current step length in 60 Hz frames
+    
+    // Hittable mobs by tile, rebuilt for the projectile pass
+    SpatialGrid mobGrid;
 };
 
 }  // namespace CanalUx
\ No newline at end of file
@@ -0,0 +1,41 @@
+/*
+ * CanalUx - Lock Keeper Boss
+ * Level 2 boss: walks the top edge of a shrinking arena, slamming out
+ * shockwave rings and throwing shopping trolleys that become obstacles.
+ */
+
+#pragma once
+
+#include <tyra>
+#include "managers/boss_controller.hpp"
+#include "managers/bullet_emitter.hpp"
+
+namespace CanalUx {
+
+class LockKeeperBoss : public BossController {
+public:
+    LockKeeperBoss();
+
+    // Back to the start of a fight, keeping the emitters' storage
+    void reset();
+
+    // One step of the Lock Keeper's AI (stepFrames: step length in 60 Hz frames)
+    void update(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager, SightCache& sightCache, float stepFrames);
+
+    // Trolley in flight, for rendering
+    float getTrolleyProgress() const { return trolleyProgress; }
+    const Tyra::Vec2& getTrolleyTarget() const { return trolleyTarget; }
+
+private:
+    float ringRadius;          // Current radius of shockwave ring
+    Tyra::Vec2 slamPosition;   // Center of slam attack
+    Tyra::Vec2 trolleyTarget;  // Where trolley will land
+    float trolleyProgress;     // 0-1 flight progress
+    int trolleysThrown;        // Count of trolleys thrown this fight
+    Tyra::Vec2 shotDirection;  // Direction of warning shot
+    Tyra::Vec2 shotPosition;   // Where the warning shot was fired from
+    BulletEmitter shockwave;   // Ring of shots riding the slam's shockwave
+    BulletEmitter warningShot; // Accelerating shots along shotDirection
+};
+
+}  // namespace CanalUx
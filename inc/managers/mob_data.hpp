@@ -0,0 +1,108 @@
+/*
+ * CanalUx - Mob Data
+ * Mob types, behavior states and the per-mob record MobManager keeps for
+ * every mob. Separate from MobManager so boss controllers can work on a
+ * mob without depending on the manager.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <tyra>
+#include "core/constants.hpp"
+#include "core/random.hpp"
+
+namespace CanalUx {
+
+// Mob types with unique behaviors
+enum class MobType : uint8_t {
+    DUCK = 0,    // Dumb chaser - just runs at player
+    SWAN = 1,    // Shooter - keeps distance and shoots feathers
+    FROG = 2,    // Jumper - hops around, submerges between jumps
+    FISH = 3,    // Fast swimmer - quick but low health (future)
+    BOSS = 10,   // Generic boss (legacy)
+    
+    // Specific bosses per level
+    BOSS_PIKE = 11,        // Level 1 - Giant pike fish
+    BOSS_LOCKKEEPER = 12,  // Level 2 - The Lock Keeper
+    BOSS_NANNY = 13        // Level 3 - Nanny (grandma)
+};
+
+// Every type from BOSS on is a boss
+constexpr bool isBossType(MobType type) { return type >= MobType::BOSS; }
+
+// Mob behavior states
+enum class MobState : uint8_t {
+    IDLE,
+    CHASING,
+    ATTACKING,
+    JUMPING,
+    SUBMERGED,
+    SURFACING,
+    
+    // Pike-specific states
+    PIKE_CIRCLING,      // Swimming in circles around player
+    PIKE_CHARGING,      // Fast charge attack
+    PIKE_TAIL_SWEEP,    // Tail cleave attack
+    PIKE_LEAP,          // Leaps out of water, crashes down
+    PIKE_SUBMERGED,     // Hidden underwater, ripples visible
+    PIKE_EMERGING,      // Bursting up from water
+    
+    // Lock Keeper-specific states
+    LOCKKEEPER_WALKING,     // Walking along top edge
+    LOCKKEEPER_WINDUP,      // Raising arms for slam
+    LOCKKEEPER_SLAM,        // Slamming down - ring expanding
+    LOCKKEEPER_THROW_WINDUP,// Winding up to throw trolley
+    LOCKKEEPER_THROWING,    // Throwing trolley
+    LOCKKEEPER_STUNNED,     // Brief recovery after attack
+    LOCKKEEPER_SHOT,        // Firing accelerating warning shots
+    
+    // Nanny-specific states
+    NANNY_IDLE,             // Waiting at top of room
+    NANNY_ATTACKING,        // Normal attack phase
+    NANNY_GAUNTLET_START,   // Starting gauntlet - teleport player
+    NANNY_GAUNTLET_ACTIVE,  // Gauntlet in progress - spawning barges
+    NANNY_GAUNTLET_END,     // Player reached top, gauntlet complete
+    NANNY_STUNNED           // Vulnerable after gauntlet
+};
+
+// Per-mob state the update, collision and render passes read for every
+// mob. Kept small and non-virtual so the mob array stays dense; state
+// only some mob types need lives elsewhere (the frog side table, the boss
+// controllers).
+struct MobData {
+    Tyra::Vec2 position;
+    Tyra::Vec2 previousPosition;  // Start of the step, for render interpolation
+    Tyra::Vec2 velocity;
+    Tyra::Vec2 size;       // Pixels
+    float health;
+    float maxHealth;
+    float speed;
+    
+    // Behavior timers
+    float stateTimer;      // Time in current state
+    float actionCooldown;  // Cooldown for attacks/jumps
+    
+    Random random;         // This mob's own stream (cooldowns, attack rolls)
+    MobType type;
+    MobState state;
+    int16_t extra;         // Row in the frog side table, -1 if none
+    uint8_t lodSlot;       // Which frame of a decimated cycle this mob decides on
+    bool active;
+    bool submerged;
+    bool facingRight;      // For rendering
+    
+    MobData() : position(0.0f, 0.0f), previousPosition(0.0f, 0.0f), velocity(0.0f, 0.0f),
+                size(Constants::TILE_SIZE, Constants::TILE_SIZE),
+                health(0), maxHealth(0), speed(0), stateTimer(0), actionCooldown(0),
+                type(MobType::DUCK), state(MobState::IDLE), extra(-1), lodSlot(0),
+                active(true), submerged(false), facingRight(true) {}
+    
+    void storePreviousPosition() { previousPosition = position; }
+    Tyra::Vec2 getInterpolatedPosition(float alpha) const {
+        return Tyra::Vec2(previousPosition.x + (position.x - previousPosition.x) * alpha,
+                          previousPosition.y + (position.y - previousPosition.y) * alpha);
+    }
+};
+
+}  // namespace CanalUx
@@ -5,10 +5,19 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <tyra>
 #include "core/constants.hpp"
-#include "entities/entity.hpp"
+#include "core/random.hpp"
+#include "managers/bullet_emitter.hpp"
+#include "managers/mob_data.hpp"
+#include "managers/pike_boss.hpp"
+#include "managers/lock_keeper_boss.hpp"
+#include "managers/nanny_boss.hpp"
+#include "managers/sight_cache.hpp"
+#include "managers/spatial_grid.hpp"
+#include "world/flow_field.hpp"
 
 namespace CanalUx {
 
@@ -17,65 +26,23 @@ class Player;
 class ProjectileManager;
 class Mob;
 
-// Mob types with unique behaviors
-enum class MobType {
-    DUCK = 0,    // Dumb chaser - just runs at player
-    SWAN = 1,    // Shooter - keeps distance and shoots feathers
-    FROG = 2,    // Jumper - hops around, submerges between jumps
-    FISH = 3,    // Fast swimmer - quick but low health (future)
-    BOSS = 10,   // Generic boss (legacy)
-    
-    // Specific bosses per level
-    BOSS_PIKE = 11,        // Level 1 - Giant pike fish
-    BOSS_LOCKKEEPER = 12,  // Level 2 - The Lock Keeper
-    BOSS_NANNY = 13        // Level 3 - Nanny (grandma)
-};
-
-// Mob behavior states
-enum class MobState {
-    IDLE,
-    CHASING,
-    ATTACKING,
-    JUMPING,
-    SUBMERGED,
-    SURFACING,
-    
-    // Pike-specific states
-    PIKE_CIRCLING,      // Swimming in circles around player
-    PIKE_CHARGING,      // Fast charge attack
-    PIKE_TAIL_SWEEP,    // Tail cleave attack
-    PIKE_LEAP,          // Leaps out of water, crashes down
-    PIKE_SUBMERGED,     // Hidden underwater, ripples visible
-    PIKE_EMERGING,      // Bursting up from water
-    
-    // Lock Keeper-specific states
-    LOCKKEEPER_WALKING,     // Walking along top edge
-    LOCKKEEPER_WINDUP,      // Raising arms for slam
-    LOCKKEEPER_SLAM,        // Slamming down - ring expanding
-    LOCKKEEPER_THROW_WINDUP,// Winding up to throw trolley
-    LOCKKEEPER_THROWING,    // Throwing trolley
-    LOCKKEEPER_STUNNED,     // Brief recovery after attack
-    LOCKKEEPER_SHOT,        // Firing accelerating warning shots
-    
-    // Nanny-specific states
-    NANNY_IDLE,             // Waiting at top of room
-    NANNY_ATTACKING,        // Normal attack phase
-    NANNY_GAUNTLET_START,   // Starting gauntlet - teleport player
-    NANNY_GAUNTLET_ACTIVE,  // Gauntlet in progress - spawning barges
-    NANNY_GAUNTLET_END,     // Player reached top, gauntlet complete
-    NANNY_STUNNED           // Vulnerable after gauntlet
-};
-
 class MobManager {
 public:
+    using MobData = CanalUx::MobData;
+
     MobManager();
     ~MobManager();
 
-    // Spawning
-    void spawnMobsForRoom(Room* room, int levelNumber);
+    // Spawning - the same seed (Level::getRoomSeed) always spawns the same
+    // mobs, and each mob draws from its own stream derived from it
+    void spawnMobsForRoom(Room* room, int levelNumber, uint32_t seed);
     
-    // Update all mobs (AI sets velocity, CollisionManager resolves collisions)
-    void update(Room* currentRoom, Player* player, ProjectileManager* projectileManager);
+    // Update all mobs (AI sets velocity, CollisionManager resolves collisions),
+    // one type at a time. deltaTime is the simulation step in ms
+    void update(Room* currentRoom, Player* player, ProjectileManager* projectileManager, float deltaTime);
+    
+    // Snapshot positions for render interpolation (start of each step)
+    void storePreviousPositions();
 
     // Clear all mobs (e.g., on room change)
     void clear();
@@ -85,83 +52,70 @@ public:
     
     // Get mob count
     int getMobCount() const { return static_cast<int>(mobs.size()); }
+    
+    // Push overlapping mobs apart (run by update(), public for the host benchmarks)
+    void applyMobRepulsion();
 
-    // MobData extends Entity with mob-specific data
-    struct MobData : public Entity {
-        float health;
-        float maxHealth;
-        float speed;
-        MobType type;
-        MobState state;
-        
-        // Behavior timers
-        float stateTimer;      // Time in current state
-        float actionCooldown;  // Cooldown for attacks/jumps
-        
-        // Frog specific
+    // Frog side table
+    struct FrogData {
         Tyra::Vec2 jumpTarget;
-        
-        // Pike boss specific
-        float circleAngle;       // Current angle when circling player
-        float chargeSpeed;       // Speed during charge attack
-        Tyra::Vec2 chargeTarget; // Where pike is charging to
-        int attackPattern;       // Which attack in the pattern
-        int phase;               // Boss phase (changes behavior at health thresholds)
-        float tailSweepAngle;    // Angle for tail sweep attack
-        
-        // Lock Keeper boss specific
-        float ringRadius;        // Current radius of shockwave ring
-        float ringThickness;     // Width of the ring
-        Tyra::Vec2 slamPosition; // Center of slam attack
-        Tyra::Vec2 trolleyTarget;// Where trolley will land
-        float trolleyProgress;   // 0-1 flight progress
-        int trolleysThrown;      // Count of trolleys thrown this fight
-        Tyra::Vec2 shotDirection;// Direction of warning shot
-        Tyra::Vec2 shotPosition; // Current position of warning shot projectile
-        float shotSpeed;         // Current speed of shot (accelerates)
-        
-        // Nanny boss specific
-        int gauntletNumber;      // Which gauntlet (1 or 2)
-        float bargeSpawnTimer;   // Timer for spawning barges
-        float gauntletStartY;    // Y position player must reach to end gauntlet
-        bool gauntlet1Complete;  // Tracks if first gauntlet done
-        bool gauntlet2Complete;  // Tracks if second gauntlet done
-        int waveCounter;         // Counts waves for gap positioning
-        
-        // For rendering
-        bool facingRight;
-        float rotation;          // For pike rotation during attacks
-        
-        // Constructor to initialize Entity base and mob-specific defaults
-        MobData() : Entity(), health(0), maxHealth(0), speed(0), 
-                    type(MobType::DUCK), state(MobState::IDLE),
-                    stateTimer(0), actionCooldown(0),
-                    circleAngle(0), chargeSpeed(0), attackPattern(0), phase(1),
-                    tailSweepAngle(0), ringRadius(0), ringThickness(0.5f),
-                    trolleyProgress(0), trolleysThrown(0), shotSpeed(0),
-                    gauntletNumber(0), bargeSpawnTimer(0), gauntletStartY(0),
-                    gauntlet1Complete(false), gauntlet2Complete(false), waveCounter(0),
-                    facingRight(true), rotation(0) {}
     };
     
     const std::vector<MobData>& getMobs() const { return mobs; }
     std::vector<MobData>& getMobs() { return mobs; }
+    
+    // Lock Keeper controller (rendering draws its trolley throws)
+    const LockKeeperBoss& getLockKeeperBoss() const { return lockKeeperBoss; }
 
 private:
+    // Update mobs[begin, end), which are all of type Type
+    template <MobType Type>
+    void updateGroup(size_t begin, size_t end, Room* room, Player* player, ProjectileManager* projectileManager);
+    
+    // Unit direction for a chaser: along the flow field, or straight at the
+    // player (dx, dy, distance) when close or unreachable
+    Tyra::Vec2 getChaseDirection(const MobData& mob, float dx, float dy, float distance) const;
+    
     void updateDuck(MobData& mob, Room* room, Player* player);
     void updateSwan(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager);
     void updateFrog(MobData& mob, Room* room, Player* player);
     void updateBoss(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager);
     
-    // Boss-specific updates
-    void updatePikeBoss(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager);
-    void updateLockKeeperBoss(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager);
-    void updateNannyBoss(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager);
+    // Push one pair of mobs apart if they overlap
+    void repelPair(MobData& a, MobData& b);
     
-    void applyMobRepulsion();
+    // Repulsion starts at this multiple of the mobs' combined radius
+    static constexpr float REPULSION_MIN_DISTANCE = 1.2f;
+    // Below this many mobs repulsion checks every pair instead of the grid
+    static constexpr size_t REPULSION_GRID_MIN_MOBS = 64;
+    // Slack (tiles) around each mob's reach in the repulsion grid
+    static constexpr float REPULSION_GRID_MARGIN = 0.5f;
+    
+    // Update tiers: mobs further than this from the player (tiles - the far
+    // side of the screen, or off it) only re-decide their AI every
+    // LOD_DECISION_INTERVAL frames, staggered by lodSlot. Their movement
+    // still runs every frame, and bosses always decide every frame.
+    static constexpr float LOD_FULL_RATE_DISTANCE = 6.0f;
+    static constexpr uint32_t LOD_DECISION_INTERVAL = 4;  // Power of two
+    
+    // Side table row (the table only grows while a room is being spawned)
+    FrogData& frogDataFor(const MobData& frog) { return frogData[frog.extra]; }
+    
+    std::vector<MobData> mobs;  // Grouped by type, spawn order within a group
+    std::vector<FrogData> frogData;
+    SpatialGrid repulsionGrid;  // Rebuilt by applyMobRepulsion
+    FlowField flowField;        // Toward the player, for chasers
+    
+    // Boss controllers, reset when their boss spawns
+    PikeBoss pikeBoss;
+    LockKeeperBoss lockKeeperBoss;
+    NannyBoss nannyBoss;
+    BulletEmitter bossSpread;  // The generic boss's three-shot spread
+    
+    SightCache sightCache;  // Sight lines traced this update, shared with the bosses
     
-    std::vector<MobData> mobs;
-    float deltaTime;  // Approximate frame time
+    float stepFrames;  // Current step length in 60 Hz frames
+    uint32_t frameIndex;  // Updates so far, for the decimated AI cycle
 };
 
 }  // namespace CanalUx
\ No newline at end of file
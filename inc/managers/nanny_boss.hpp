@@ -0,0 +1,40 @@
+/*
+ * CanalUx - Nanny Boss
+ * Level 3 boss: fires down a tall room from the top, and twice sends the
+ * player back to the bottom to run a gauntlet of barges.
+ */
+
+#pragma once
+
+#include "managers/boss_controller.hpp"
+#include "managers/bullet_emitter.hpp"
+
+namespace CanalUx {
+
+class NannyBoss : public BossController {
+public:
+    NannyBoss();
+
+    // Back to the start of a fight, keeping the emitters' storage
+    void reset();
+
+    // One step of the Nanny's AI (stepFrames: step length in 60 Hz frames)
+    void update(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager, SightCache& sightCache, float stepFrames);
+
+private:
+    int attackPattern;        // 1 while a sweep attack is running
+    float sweepAngle;         // Current angle of the sweep
+    float sweepEndAngle;      // Where the current sweep stops
+    int gauntletNumber;       // Which gauntlet (1 or 2)
+    float bargeSpawnTimer;    // Timer for spawning barges
+    float gauntletStartY;     // Y position player must reach to end gauntlet
+    bool gauntlet1Complete;   // Tracks if first gauntlet done
+    bool gauntlet2Complete;   // Tracks if second gauntlet done
+    int waveCounter;          // Counts waves for gap positioning
+    BulletEmitter spreadShot;     // Arc aimed at the player
+    BulletEmitter aimedBurst;     // Shots at the player, drifting apart
+    BulletEmitter sweepShot;      // One shot per frame along sweepAngle
+    BulletEmitter gauntletSpiral; // Turning ring fired during gauntlets
+};
+
+}  // namespace CanalUx
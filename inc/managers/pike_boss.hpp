@@ -0,0 +1,35 @@
+/*
+ * CanalUx - Pike Boss
+ * Level 1 boss: a giant pike circling under the water that surfaces to
+ * bite, sweep its tail and leap at the player.
+ */
+
+#pragma once
+
+#include <tyra>
+#include "managers/boss_controller.hpp"
+#include "managers/bullet_emitter.hpp"
+
+namespace CanalUx {
+
+class PikeBoss : public BossController {
+public:
+    PikeBoss();
+
+    // Back to the start of a fight, keeping the emitters' storage
+    void reset();
+
+    // One step of the pike's AI (stepFrames: step length in 60 Hz frames)
+    void update(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager, SightCache& sightCache, float stepFrames);
+
+private:
+    float rotation;           // Facing during attacks
+    float circleAngle;        // Current angle when circling player
+    float chargeSpeed;        // Speed during charge attack
+    Tyra::Vec2 chargeTarget;  // Where pike is charging to
+    float tailSweepAngle;     // Angle for tail sweep attack
+    BulletEmitter tailSweep;  // Arc thrown by the tail sweep
+    BulletEmitter splash;     // Ring thrown up when a leap lands
+};
+
+}  // namespace CanalUx
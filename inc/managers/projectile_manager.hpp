@@ -1,56 +1,127 @@
 /*
  * CanalUx - Projectile Manager
  * Handles all projectiles in the game
+ *
+ * Projectiles are kept partitioned by owner in two fixed-capacity stores
+ * (see ProjectileStore), sized when a level loads, so shots fired mid-fight
+ * never touch the allocator and each collision pass walks only the side it
+ * cares about.
  */
 
 #pragma once
 
-#include <vector>
+#include <cstdint>
 #include <tyra>
+#include "core/constants.hpp"
 #include "entities/projectile.hpp"
+#include "managers/projectile_store.hpp"
 
 namespace CanalUx {
 
 class Room;
 
+/**
+ * Reference to a pooled projectile that goes stale once the projectile is
+ * removed (its slot's generation moves on)
+ */
+struct ProjectileHandle {
+    uint16_t index;       // Slot, top bit set for enemy shots
+    uint16_t generation;
+
+    ProjectileHandle() : index(0), generation(0) {}
+    ProjectileHandle(uint16_t i, uint16_t g) : index(i), generation(g) {}
+
+    // Generation 0 is never handed out
+    bool isValid() const { return generation != 0; }
+};
+
+struct ProjectilePoolStats {
+    int capacity;
+    int active;
+    int peak;       // Most live at once since the last reset
+    int spawned;
+    int overflows;  // Spawns dropped because the pool was full
+
+    ProjectilePoolStats() : capacity(0), active(0), peak(0), spawned(0), overflows(0) {}
+};
+
 class ProjectileManager {
 public:
     ProjectileManager();
     ~ProjectileManager();
 
-    // Spawning
-    void spawnPlayerProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage);
-    void spawnEnemyProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage);
-    void spawnEnemyProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage, float maxRange);
-    
+    // Size both pools (clears them). Only call between fights - this is the
+    // one place the pools allocate.
+    void setCapacity(int enemyCapacity, int playerCapacity = Constants::PLAYER_PROJECTILE_CAPACITY);
+    int getCapacity() const { return playerShots.getCapacity() + enemyShots.getCapacity(); }
+
+    // Spawning - returns an invalid handle if the pool is full
+    ProjectileHandle spawnPlayerProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage);
+    ProjectileHandle spawnEnemyProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage);
+    ProjectileHandle spawnEnemyProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage, float maxRange);
+
     // Spawn accelerating projectile (starts slow, speeds up)
-    void spawnAcceleratingProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage, 
-                                      float acceleration, float maxSpeed, bool fromPlayer = false);
-    
+    ProjectileHandle spawnAcceleratingProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage,
+                                                 float acceleration, float maxSpeed, bool fromPlayer = false);
+
     // Spawn barge (large projectile that hits submerged players)
-    void spawnBarge(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage);
+    ProjectileHandle spawnBarge(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage);
+
+    // Spawn a whole volley of enemy shots in one go: copies of prototype at
+    // positions[i] moving at velocities[i]. No handles; returns how many fit
+    // in the pool (the rest count as overflows).
+    int spawnEnemyVolley(const Projectile& prototype, const Tyra::Vec2* positions,
+                         const Tyra::Vec2* velocities, int count);
+
+    // Update all projectiles (deltaTime in ms)
+    void update(Room* currentRoom, float deltaTime);
 
-    // Update all projectiles
-    void update(Room* currentRoom);
+    // Snapshot positions for render interpolation (start of each step)
+    void storePreviousPositions();
 
     // Clear all projectiles (e.g., on room change)
     void clear();
 
-    // Access for collision checking and rendering
-    std::vector<Projectile>& getProjectiles() { return projectiles; }
-    const std::vector<Projectile>& getProjectiles() const { return projectiles; }
+    // Access for collision checking and rendering - player shots, then
+    // enemy shots, each in spawn order
+    ProjectileRange<ProjectileStore> getProjectiles() {
+        return ProjectileRange<ProjectileStore>(&playerShots, &enemyShots);
+    }
+    ProjectileRange<const ProjectileStore> getProjectiles() const {
+        return ProjectileRange<const ProjectileStore>(&playerShots, &enemyShots);
+    }
+    int getCount() const { return playerShots.getCount() + enemyShots.getCount(); }
+
+    // Get only player or enemy projectiles (no allocation)
+    ProjectileRange<ProjectileStore> getPlayerProjectiles() { return ProjectileRange<ProjectileStore>(&playerShots); }
+    ProjectileRange<ProjectileStore> getEnemyProjectiles() { return ProjectileRange<ProjectileStore>(&enemyShots); }
+    ProjectileRange<const ProjectileStore> getPlayerProjectiles() const {
+        return ProjectileRange<const ProjectileStore>(&playerShots);
+    }
+    ProjectileRange<const ProjectileStore> getEnemyProjectiles() const {
+        return ProjectileRange<const ProjectileStore>(&enemyShots);
+    }
+
+    // Whether a handle still refers to the projectile it was spawned as
+    bool isAlive(ProjectileHandle handle) const;
+
+    // Point projectile at the projectile a handle refers to. Returns false
+    // (leaving projectile alone) once the handle has gone stale.
+    bool tryGet(ProjectileHandle handle, ProjectileRef& projectile);
 
-    // Get only player or enemy projectiles
-    std::vector<Projectile*> getPlayerProjectiles();
-    std::vector<Projectile*> getEnemyProjectiles();
-    
     // Low-level add (for compatibility)
-    void addProjectile(const Projectile& projectile);
+    ProjectileHandle addProjectile(const Projectile& projectile);
+
+    // Pool usage (peak and counters run until resetStats)
+    const ProjectilePoolStats& getStats() const { return stats; }
+    void resetStats();
 
 private:
-    void removeDestroyedProjectiles();
+    static constexpr uint16_t ENEMY_HANDLE_BIT = 0x8000;
 
-    std::vector<Projectile> projectiles;
+    ProjectileStore playerShots;
+    ProjectileStore enemyShots;
+    ProjectilePoolStats stats;
 };
 
-}  // namespace CanalUx
\ No newline at end of file
+}  // namespace CanalUx
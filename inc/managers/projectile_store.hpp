@@ -0,0 +1,185 @@
+/*
+ * CanalUx - Projectile Store
+ * Fixed-capacity pool holding one owner's live projectiles (ProjectileManager
+ * keeps one for the player's shots and one for enemy shots).
+ *
+ * Live projectile state is stored as parallel arrays packed in spawn order
+ * (the order every pass over the projectiles sees them in). The per-step
+ * movement fields are updated together by one batched kernel; the fields
+ * only collisions and rendering read sit apart in ProjectileInfo. Free slots
+ * are kept on a stack and map onto packed indices, so handles survive the
+ * compaction after each update.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <tyra>
+#include "entities/projectile.hpp"
+
+namespace CanalUx {
+
+/**
+ * Per-projectile data the movement kernel never touches
+ */
+struct ProjectileInfo {
+    Tyra::Vec2 size;  // Pixels
+    float damage;
+    ProjectileType type;
+    bool fromPlayer;
+    bool hitsSubmerged;
+    bool ignoresWalls;
+};
+
+class ProjectileStore {
+public:
+    ProjectileStore();
+
+    // Size the pool (clears it) - the only place it allocates
+    void setCapacity(int capacity);
+    int getCapacity() const { return static_cast<int>(generations.size()); }
+    int getCount() const { return count; }
+    bool isFull() const { return freeSlots.empty(); }
+
+    // Copy a projectile in. Returns its slot (-1 when full).
+    int add(const Projectile& projectile);
+
+    // Add count copies of a prototype that differ only in position and
+    // velocity, in order, stopping when the pool fills. Returns how many
+    // were added.
+    int addVolley(const Projectile& prototype, const Tyra::Vec2* positions, const Tyra::Vec2* velocities, int count);
+
+    // Slot lookups for handles
+    uint16_t getGeneration(int slot) const { return generations[slot]; }
+    int getPackedIndex(int slot) const { return packedOf[slot]; }
+
+    // Batched movement for every live projectile: accelerate, clamp speed,
+    // move, accumulate range and expire
+    void integrate(float stepFrames);
+
+    // Drop destroyed projectiles, keeping spawn order
+    void removeDestroyed();
+
+    void storePreviousPositions();
+    void clear();
+
+    // Packed live projectiles, [0, count) in spawn order. Hot fields first.
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> traveled;      // Distance so far (tiles)
+    std::vector<float> maxRange;
+    std::vector<float> acceleration;  // Speed gain per 60 Hz step (0 = none)
+    std::vector<float> maxSpeed;
+    std::vector<uint32_t> alive;      // All bits set while active, 0 once destroyed
+    std::vector<float> prevX;         // Render interpolation
+    std::vector<float> prevY;
+    std::vector<ProjectileInfo> info;
+
+private:
+    void releaseSlot(uint16_t slot);
+
+    int count;
+    std::vector<uint16_t> slotOf;       // Packed index -> slot
+    std::vector<uint16_t> generations;  // Per slot, bumped on release
+    std::vector<uint16_t> packedOf;     // Slot -> packed index
+    std::vector<uint16_t> freeSlots;    // Stack of unused slots
+};
+
+/**
+ * View of one live projectile (by value - cheap to copy). Mirrors the
+ * Projectile accessors so collision and rendering code reads the same.
+ */
+template <typename Store>
+class BasicProjectileRef {
+public:
+    BasicProjectileRef(Store* t_store, int t_index) : store(t_store), index(t_index) {}
+
+    Tyra::Vec2 getPosition() const { return Tyra::Vec2(store->posX[index], store->posY[index]); }
+    Tyra::Vec2 getVelocity() const { return Tyra::Vec2(store->velX[index], store->velY[index]); }
+    Tyra::Vec2 getInterpolatedPosition(float alpha) const {
+        float prevX = store->prevX[index];
+        float prevY = store->prevY[index];
+        return Tyra::Vec2(prevX + (store->posX[index] - prevX) * alpha,
+                          prevY + (store->posY[index] - prevY) * alpha);
+    }
+    const Tyra::Vec2& getSize() const { return store->info[index].size; }
+    float getDamage() const { return store->info[index].damage; }
+    float getDistanceTraveled() const { return store->traveled[index]; }
+    ProjectileType getProjectileType() const { return store->info[index].type; }
+    bool isFromPlayer() const { return store->info[index].fromPlayer; }
+    bool getHitsSubmerged() const { return store->info[index].hitsSubmerged; }
+    bool getIgnoresWalls() const { return store->info[index].ignoresWalls; }
+    bool isActive() const { return store->alive[index] != 0; }
+
+    // Removed at the end of the next update
+    void destroy() const { store->alive[index] = 0; }
+
+private:
+    Store* store;
+    int index;  // Position in the packed arrays
+};
+
+using ProjectileRef = BasicProjectileRef<ProjectileStore>;
+using ConstProjectileRef = BasicProjectileRef<const ProjectileStore>;
+
+/**
+ * Iterates live projectiles of one or more stores, each in spawn order.
+ * Range-for friendly; yields refs by value, so loop with `auto` rather
+ * than `auto&`. Never allocates.
+ */
+template <typename Store>
+class ProjectileRange {
+public:
+    static constexpr int MAX_STORES = 2;
+
+    class Iterator {
+    public:
+        Iterator(const ProjectileRange* t_range, int t_store, int t_index)
+            : range(t_range), storeIndex(t_store), index(t_index) {
+            skipExhausted();
+        }
+        BasicProjectileRef<Store> operator*() const {
+            return BasicProjectileRef<Store>(range->stores[storeIndex], index);
+        }
+        Iterator& operator++() {
+            ++index;
+            skipExhausted();
+            return *this;
+        }
+        bool operator==(const Iterator& other) const { return storeIndex == other.storeIndex && index == other.index; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        void skipExhausted() {
+            while (storeIndex < range->storeCount && index >= range->stores[storeIndex]->getCount()) {
+                storeIndex++;
+                index = 0;
+            }
+        }
+
+        const ProjectileRange* range;
+        int storeIndex;
+        int index;
+    };
+
+    explicit ProjectileRange(Store* store) : storeCount(1) { stores[0] = store; stores[1] = nullptr; }
+    ProjectileRange(Store* first, Store* second) : storeCount(2) { stores[0] = first; stores[1] = second; }
+
+    Iterator begin() const { return Iterator(this, 0, 0); }
+    Iterator end() const { return Iterator(this, storeCount, 0); }
+    int size() const {
+        int total = 0;
+        for (int i = 0; i < storeCount; i++) total += stores[i]->getCount();
+        return total;
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    Store* stores[MAX_STORES];
+    int storeCount;
+};
+
+}  // namespace CanalUx
@@ -0,0 +1,48 @@
+/*
+ * CanalUx - Sight Cache
+ * Line-of-sight memo for enemy shooters. Shots fired from the same tile at
+ * the same tile within one update share a single trace. MobManager owns
+ * one, clears it every update and hands it to the boss controllers.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <tyra>
+
+namespace CanalUx {
+
+class Room;
+class Player;
+
+class SightCache {
+public:
+    SightCache();
+
+    // Forget every stored sight line (start of each update)
+    void clear() { entries.clear(); }
+
+    // Whether a shot from 'from' would reach 'to' past walls and obstacles.
+    // A different room or room revision drops what was stored.
+    bool hasLineOfSight(const Room* room, const Tyra::Vec2& from, const Tyra::Vec2& to);
+
+    // Centre of the player (tiles) - what shooters aim their sight line at
+    static Tyra::Vec2 getPlayerCenter(const Player* player);
+
+private:
+    // Most results remembered per update - further queries are traced
+    // without being stored
+    static constexpr size_t MAX_ENTRIES = 32;
+
+    struct Entry {
+        int fromTile;  // y * width + x
+        int toTile;
+        bool visible;
+    };
+    std::vector<Entry> entries;
+    const Room* room;
+    uint32_t revision;
+};
+
+}  // namespace CanalUx
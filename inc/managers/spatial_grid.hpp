@@ -0,0 +1,100 @@
+/*
+ * CanalUx - Spatial Grid
+ * Uniform broadphase grid with one-tile cells, rebuilt each time a system
+ * needs it. Entities are registered by id (their index in the caller's
+ * array) under every cell their box touches - register small movers as
+ * points (zero size) and let pair searches supply the reach.
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace CanalUx {
+
+class SpatialGrid {
+public:
+    // Cells per side at most - boxes beyond the covered area are clamped
+    // onto the border cells, which only costs extra candidates
+    static constexpr int MAX_CELLS_PER_SIDE = 64;
+
+    SpatialGrid();
+
+    // Start a new build covering [minX, maxX] x [minY, maxY] (tiles). Keeps
+    // the storage of earlier builds, so a warmed-up grid never allocates.
+    void reset(float minX, float minY, float maxX, float maxY);
+
+    // Register an entity's box (tiles). Ids must be added in ascending order.
+    void insert(int id, float x, float y, float width, float height);
+
+    int getCount() const { return static_cast<int>(entries.size()); }
+
+    // Call fn(id) for every id registered in a cell the box touches. An id
+    // spanning several of those cells comes up once per cell, in no
+    // particular order - keep the lowest index that matters, as
+    // Room::findObstacle does, where order matters.
+    template <typename Fn>
+    void forEachCandidate(float x, float y, float width, float height, Fn fn) const;
+
+    // Call fn(a, b) once for every pair of ids whose boxes come within
+    // range of each other (by cells, so a superset of the true pairs) with
+    // a < b, ordered by a then b - the order of a nested i < j loop.
+    // fn may move the entities, but the grid keeps the boxes it was given.
+    template <typename Fn>
+    void forEachPair(float range, Fn fn);
+
+private:
+    struct CellSpan {
+        int minX, minY, maxX, maxY;  // Inclusive
+    };
+    struct Entry {
+        int id;
+        float x, y, width, height;
+    };
+    struct Link {
+        int id;
+        int next;  // Next link in the same cell, -1 at the end
+    };
+
+    CellSpan getCellSpan(float x, float y, float width, float height) const;
+
+    // Ids above minId sharing a cell with the span, ascending, each once
+    void collectAbove(const CellSpan& span, int minId, std::vector<int>& out) const;
+
+    float originX;
+    float originY;
+    int columns;
+    int rows;
+    std::vector<int> heads;  // Per cell (y * columns + x), -1 if empty
+    std::vector<Link> links;
+    std::vector<Entry> entries;
+    std::vector<int> pairScratch;
+};
+
+template <typename Fn>
+void SpatialGrid::forEachCandidate(float x, float y, float width, float height, Fn fn) const {
+    if (heads.empty()) return;
+
+    CellSpan span = getCellSpan(x, y, width, height);
+    for (int cy = span.minY; cy <= span.maxY; cy++) {
+        for (int cx = span.minX; cx <= span.maxX; cx++) {
+            for (int link = heads[cy * columns + cx]; link >= 0; link = links[link].next) {
+                fn(links[link].id);
+            }
+        }
+    }
+}
+
+template <typename Fn>
+void SpatialGrid::forEachPair(float range, Fn fn) {
+    for (const Entry& entry : entries) {
+        CellSpan span = getCellSpan(entry.x - range, entry.y - range,
+                                    entry.width + range * 2.0f, entry.height + range * 2.0f);
+        collectAbove(span, entry.id, pairScratch);
+        for (int other : pairScratch) {
+            fn(entry.id, other);
+        }
+    }
+}
+
+}  // namespace CanalUx
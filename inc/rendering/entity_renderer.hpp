@@ -29,20 +29,24 @@ public:
                 const Player* player,
                 const ProjectileManager* projectileManager,
                 const MobManager* mobManager,
-                const Room* room);
+                const Room* room,
+                float alpha);  // Interpolation between previous and current sim step
 
 private:
     void renderPlayer(Tyra::Renderer2D* renderer, 
                       const Camera* camera, 
-                      const Player* player);
+                      const Player* player,
+                      float alpha);
     
     void renderProjectiles(Tyra::Renderer2D* renderer, 
                            const Camera* camera, 
-                           const ProjectileManager* projectileManager);
+                           const ProjectileManager* projectileManager,
+                           float alpha);
     
     void renderMobs(Tyra::Renderer2D* renderer, 
                     const Camera* camera, 
-                    const MobManager* mobManager);
+                    const MobManager* mobManager,
+                    float alpha);
     
     void renderPikeBoss(Tyra::Renderer2D* renderer,
                         const MobManager::MobData& pike,
@@ -50,6 +54,7 @@ private:
     
     void renderLockKeeperBoss(Tyra::Renderer2D* renderer, 
                                const MobManager::MobData& lk, 
+                               const LockKeeperBoss& lkState,
                                const Tyra::Vec2& screenPos,
                                const Room* room);
     
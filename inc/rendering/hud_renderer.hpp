@@ -14,6 +14,7 @@ namespace CanalUx {
 
 class Player;
 class Level;
+class Profiler;
 
 class HUDRenderer {
 public:
@@ -28,6 +29,9 @@ public:
 
     // Render HUD elements
     void render(Tyra::Renderer2D* renderer, const Player* player, const Level* level);
+    
+    // Debug overlay: frame time stats and per-phase breakdown
+    void renderProfiler(Tyra::Renderer2D* renderer, const Profiler* profiler);
 
 private:
     void renderHealth(Tyra::Renderer2D* renderer, const Player* player);
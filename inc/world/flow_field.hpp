@@ -0,0 +1,59 @@
+/*
+ * CanalUx - Flow Field
+ * Breadth-first distance field over a room's tiles toward one target tile
+ * (the player), so chasing mobs steer around walls and obstacles instead of
+ * into them. Rebuilt only when the target moves to another tile or the
+ * room's collision changes; sampling it is a table lookup.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace CanalUx {
+
+class Room;
+
+class FlowField {
+public:
+    static constexpr uint16_t UNREACHABLE = 0xFFFF;
+
+    FlowField();
+
+    // Aim the field at a target tile in a room. Returns true if it had to
+    // be rebuilt (new room, target tile or room revision).
+    bool update(const Room* room, int targetX, int targetY);
+
+    // Forget the current field (next update rebuilds)
+    void invalidate() { room = nullptr; }
+
+    int getTargetX() const { return targetX; }
+    int getTargetY() const { return targetY; }
+
+    // Steps to the target from a tile - UNREACHABLE if walled off or outside
+    uint16_t getDistance(int x, int y) const;
+
+    // Neighbouring tile to head for from (x, y). False on the target tile
+    // or where the target can't be reached.
+    bool getNextTile(int x, int y, int& nextX, int& nextY) const;
+
+private:
+    void rebuild();
+
+    // Tiles enemies can't walk through: solid tiles and enemy obstacles
+    void markBlocked();
+
+    const Room* room;
+    uint32_t revision;  // Room::getRevision() the field was built for
+    int targetX;
+    int targetY;
+    int width;
+    int height;
+    std::vector<uint16_t> distances;  // Per tile (y * width + x)
+    std::vector<int8_t> nextStep;     // Per tile, index into the step table, -1 if none
+    std::vector<uint8_t> blocked;     // Per tile
+    std::vector<int> queue;
+};
+
+}  // namespace CanalUx
@@ -7,7 +7,7 @@
 
 #include <tyra>
 #include <vector>
-#include <random>
+#include "core/random.hpp"
 #include "world/room.hpp"
 #include "world/room_generator.hpp"
 #include "core/constants.hpp"
@@ -21,14 +21,35 @@ namespace CanalUx {
  */
 class Level {
 public:
-    explicit Level(int levelNumber);
+    // The same seed always generates the same layout
+    Level(int levelNumber, unsigned int seed);
     ~Level();
 
-    // Generation
+    // Generation - builds the layout, and all room tiles unless
+    // Constants::LAZY_ROOM_GENERATION is on
     void generate();
     void printDebugMap() const;
+    
+    // Incremental generation: beginGeneration(), then generateStep() until it
+    // returns true. Each step is a small slice (one layout pass or one room),
+    // and the result is the same as generate().
+    void beginGeneration();
+    bool generateStep();
+    bool isReady() const { return generationPhase == GenerationPhase::DONE; }
+    
+    // Incremental teardown: frees one row of rooms' tiles per call, returns
+    // true when everything is released and the level can be destroyed cheaply
+    bool releaseStep();
+    
+    // Generate tiles for up to maxRooms rooms next to the current one, so
+    // walking through a door doesn't stall. Returns how many were generated.
+    int generateNeighbourRooms(int maxRooms);
+    int getGeneratedRoomCount() const { return generatedRoomCount; }
 
     // Room access
+    // The non-const version generates the room's tiles on first access. The
+    // const version may return a room that only has layout data (type, doors,
+    // visited/cleared) - enough for the minimap.
     Room* getRoom(int gridX, int gridY);
     const Room* getRoom(int gridX, int gridY) const;
     Room* getCurrentRoom() { return currentRoom; }
@@ -40,6 +61,11 @@ public:
     void setCurrentRoom(int gridX, int gridY);
     bool canMoveToRoom(int gridX, int gridY) const;
     
+    // Move to the neighbouring room if the player walked off an edge with a door.
+    // Places the player at the entry side of the new room, or clamps them to the
+    // edge of the current one. Returns true if the current room changed.
+    bool tryExitRoom(Tyra::Vec2& playerPosition);
+    
     // Grid position tracking
     int getCurrentGridX() const { return currentGridX; }
     int getCurrentGridY() const { return currentGridY; }
@@ -48,6 +74,13 @@ public:
 
     // Level info
     int getLevelNumber() const { return levelNumber; }
+    unsigned int getSeed() const { return seed; }
+    
+    // Seed for what happens in a room (mob spawns) - fixed per room, so it
+    // doesn't depend on the order rooms are visited in
+    uint32_t getRoomSeed(int gridX, int gridY) const {
+        return Random::deriveSeed(seed, static_cast<uint32_t>(gridY * GRID_WIDTH + gridX) + 1);
+    }
     int getRoomCount() const { return roomCount; }
     
     // Grid access for minimap
@@ -57,9 +90,13 @@ public:
 private:
     // Generation phases
     void initializeGrid();
-    void generateRoomLayout();
+    void placeStartRoom();
+    void expandLayout();
+    void markEndRooms();
     void assignSpecialRooms();
-    void generateRoomTiles();
+    void planRoomSizes();
+    void findBossApproach();
+    void generateRoomTiles(int x, int y);
     void placeBossRoomDangerSigns();
     
     // Layout helpers
@@ -72,13 +109,41 @@ private:
     // Grid of rooms
     std::vector<std::vector<Room>> grid;
     
+    // Room sizes rolled with the layout, so lazily generated rooms come out
+    // the same whatever order they are visited in
+    struct RoomPlan {
+        int width;
+        int height;
+    };
+    std::vector<std::vector<RoomPlan>> roomPlans;
+    int generatedRoomCount;
+    
+    // Incremental generation / teardown state
+    enum class GenerationPhase {
+        NOT_STARTED,
+        LAYOUT,
+        SPECIAL_ROOMS,
+        ROOM_TILES,
+        DONE
+    };
+    GenerationPhase generationPhase;
+    int layoutIterations;
+    int tileCursor;     // Next grid cell (y * GRID_WIDTH + x) for eager tile generation
+    int releasedRows;
+    
+    // Room next to the boss room that gets danger signs (-1 if none)
+    int approachGridX;
+    int approachGridY;
+    int approachDoorDir;
+    
     // Generation state
     std::vector<Tyra::Vec2> roomQueue;  // Rooms to expand from
     RoomGenerator roomGenerator;
-    std::mt19937 rng;  // Random number generator
+    Random rng;  // Layout stream (rooms draw from their own, see getRoomSeed)
 
     // Level properties
     int levelNumber;
+    unsigned int seed;
     int roomCount;
     int targetRoomCount;
     
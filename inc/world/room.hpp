@@ -6,6 +6,8 @@
 #pragma once
 
 #include <tyra>
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include "core/constants.hpp"
 
@@ -35,6 +37,40 @@ struct SideDoor {
     SideDoor(float y, bool left) : yPosition(y), isLeftSide(left) {}
 };
 
+/**
+ * Collision bits for a room cell, derived from its tile layers
+ */
+namespace CollisionFlags {
+    constexpr uint8_t SOLID = 1 << 0;               // Land or scenery - blocks movement and shots
+    constexpr uint8_t WATER = 1 << 1;               // Has a water tile
+    constexpr uint8_t GATE = 1 << 2;                // Lock gate closing a door (opened on clear)
+    constexpr uint8_t SUBMERGED_PASSABLE = 1 << 3;  // Solid only because of scenery - can dive under
+}
+
+/**
+ * What a dynamic obstacle blocks (bits, see RoomObstacle)
+ */
+namespace ObstacleBlocks {
+    constexpr uint8_t PLAYER = 1 << 0;
+    constexpr uint8_t ENEMIES = 1 << 1;
+    constexpr uint8_t PLAYER_SHOTS = 1 << 2;
+    constexpr uint8_t ENEMY_SHOTS = 1 << 3;
+}
+
+/**
+ * One cell of a room's tile map. All layers of a cell sit together so a
+ * lookup touches a single cache line. Tile ids index the 16x16 tileset
+ * (1-based, 0 = no tile), so a byte per layer is enough.
+ */
+struct RoomCell {
+    uint8_t water;
+    uint8_t land;
+    uint8_t scenery;
+    uint8_t collision;  // CollisionFlags, kept in sync by Room
+    
+    RoomCell() : water(0), land(0), scenery(0), collision(0) {}
+};
+
 /**
  * Obstacle placed during gameplay (e.g., trolley from Lock Keeper)
  */
@@ -50,6 +86,13 @@ struct RoomObstacle {
     RoomObstacle() : position(0, 0), size(1.0f, 1.0f), type(0),
                      blocksPlayer(true), blocksEnemies(true),
                      blocksPlayerShots(true), blocksEnemyShots(true) {}
+    
+    uint8_t getBlocks() const {
+        return (blocksPlayer ? ObstacleBlocks::PLAYER : 0) |
+               (blocksEnemies ? ObstacleBlocks::ENEMIES : 0) |
+               (blocksPlayerShots ? ObstacleBlocks::PLAYER_SHOTS : 0) |
+               (blocksEnemyShots ? ObstacleBlocks::ENEMY_SHOTS : 0);
+    }
 };
 
 /**
@@ -65,11 +108,34 @@ public:
     void generate(RoomGenerator* generator, int width, int height);
     void createDoor(int directionX, int directionY);
     void completeClear();  // Called when all enemies defeated
+    void releaseTiles();   // Free tile/obstacle memory (level teardown)
 
-    // Tile access (const for use in collision detection)
-    int getLandTile(int x, int y) const;
-    int getWaterTile(int x, int y) const;
-    int getSceneryTile(int x, int y) const;
+    // Tile access (bounds checked - out of bounds is empty)
+    bool isInBounds(int x, int y) const { return x >= 0 && x < width && y >= 0 && y < height; }
+    const RoomCell& getCell(int x, int y) const { return isInBounds(x, y) ? getCells()[y * width + x] : emptyCell; }
+    int getLandTile(int x, int y) const { return getCell(x, y).land; }
+    int getWaterTile(int x, int y) const { return getCell(x, y).water; }
+    int getSceneryTile(int x, int y) const { return getCell(x, y).scenery; }
+    
+    // Collision queries (bounds checked - out of bounds is open)
+    uint8_t getCollision(int x, int y) const { return getCell(x, y).collision; }
+    bool isSolid(int x, int y) const { return (getCollision(x, y) & CollisionFlags::SOLID) != 0; }
+    
+    // Unchecked access for inner loops - caller keeps x/y inside the room
+    const RoomCell& cellAt(int x, int y) const { return getCells()[y * width + x]; }
+    const RoomCell* getCells() const { return sharedCells ? sharedCells->data() : ownCells.data(); }
+    
+    // Whether the tile map is still a template shared with other rooms
+    bool isUsingTemplate() const { return sharedCells != nullptr; }
+    
+    // Changes whenever the room's tiles or obstacles do. Unique across all
+    // rooms, so caches of derived data (FlowField) can compare it alone.
+    uint32_t getRevision() const { return revision; }
+    
+    // Fill in CollisionFlags for a whole tile map with the given doors
+    static void buildCollisionMask(std::vector<RoomCell>& cells, int width, int height,
+                                   bool doorLeft, bool doorRight, bool doorTop, bool doorBottom);
+    
     void setSceneryTile(int x, int y, int tileId);
     void setLandTile(int x, int y, int tileId);
     void setWaterTile(int x, int y, int tileId);
@@ -80,6 +146,17 @@ public:
     const std::vector<RoomObstacle>& getObstacles() const { return obstacles; }
     bool hasObstacleAt(float x, float y) const;
     
+    // First obstacle (in placement order) blocking any of the ObstacleBlocks
+    // bits that overlaps the box, or nullptr. Only looks at the tiles the
+    // box covers.
+    const RoomObstacle* findObstacle(const Tyra::Vec2& position, const Tyra::Vec2& size,
+                                     uint8_t blocks) const;
+    
+    // Whether the straight line between two points (tiles) is clear of solid
+    // tiles and of obstacles blocking any of the ObstacleBlocks bits. Walks
+    // only the tiles the line crosses (grid DDA); out of bounds is open.
+    bool hasLineOfSight(const Tyra::Vec2& from, const Tyra::Vec2& to, uint8_t blocks) const;
+    
     // Arena shrinking (for Lock Keeper boss)
     void shrinkArena(float amount);            // Shrink from all edges
     void shrinkArenaHorizontal(float amount);  // Shrink left/right only
@@ -89,11 +166,6 @@ public:
     float getArenaMaxY() const { return arenaMaxY; }
     void resetArenaBounds();
 
-    // Map access
-    const std::vector<std::vector<int>>& getLandMap() const { return landMap; }
-    const std::vector<std::vector<int>>& getWaterMap() const { return waterMap; }
-    const std::vector<std::vector<int>>& getSceneryMap() const { return sceneryMap; }
-
     // Properties
     int getWidth() const { return width; }
     int getHeight() const { return height; }
@@ -124,14 +196,50 @@ public:
     void clearSideDoors() { sideDoors.clear(); }
 
 private:
-    // Tile maps (y, x indexing)
-    std::vector<std::vector<int>> landMap;
-    std::vector<std::vector<int>> waterMap;
-    std::vector<std::vector<int>> sceneryMap;
+    // Writable cell - copies a shared template on the first edit
+    RoomCell& editCell(int x, int y);
+    
+    // Recompute a cell's CollisionFlags from its layers
+    void updateCollision(int x, int y);
+    static uint8_t collisionFlagsFor(const RoomCell& cell, bool gateCell);
+    static bool isGateCell(int x, int y, int width, int height,
+                           bool doorLeft, bool doorRight, bool doorTop, bool doorBottom);
+    
+    // Tile range an area covers, clamped to the room
+    void getTileSpan(float x, float y, float w, float h,
+                     int& minX, int& minY, int& maxX, int& maxY) const;
+    
+    // Whether the segment from-to crosses an obstacle linked from the tile
+    // that blocks any of the bits
+    bool segmentHitsObstacle(int x, int y, const Tyra::Vec2& from, const Tyra::Vec2& to,
+                             uint8_t blocks) const;
+    
+    // Add an area to an obstacle's entries in the grid index
+    void linkObstacle(int index, float x, float y, float w, float h);
+    
+    // Grow a side's arena barrier by a strip (or start it)
+    void extendBarrier(int& barrier, float x, float y, float w, float h);
+    
+    // Tile map, row-major (index y * width + x). Normally an immutable
+    // template shared with every room of the same shape; rooms that edit
+    // tiles (danger signs, side doors) get their own copy.
+    std::shared_ptr<const std::vector<RoomCell>> sharedCells;
+    std::vector<RoomCell> ownCells;
+    static const RoomCell emptyCell;
     
     // Dynamic obstacles
     std::vector<RoomObstacle> obstacles;
     
+    // Uniform grid over the obstacles: per tile, a linked list (through
+    // obstacleLinks) of the obstacles overlapping it. Built on the first
+    // addObstacle, so rooms without obstacles pay nothing.
+    struct ObstacleLink {
+        int obstacle;  // Index into obstacles
+        int next;      // Next link in the same tile, -1 at the end
+    };
+    std::vector<int> obstacleHeads;  // Per tile (y * width + x), -1 if empty
+    std::vector<ObstacleLink> obstacleLinks;
+    
     // Side doors for Nanny boss room (barge spawn points)
     std::vector<SideDoor> sideDoors;
     
@@ -157,6 +265,19 @@ private:
     bool generated;   // Tiles have been generated
     bool cleared;
     bool visited;
+    
+    // Generator the template came from (swaps in the cleared template)
+    RoomGenerator* generator;
+    
+    // Arena barriers (Lock Keeper): one rectangle per side, grown as the
+    // arena shrinks. Index into obstacles, -1 if none yet.
+    int leftBarrier;
+    int rightBarrier;
+    
+    // See getRevision()
+    void touch() { revision = ++lastRevision; }
+    uint32_t revision;
+    static uint32_t lastRevision;
 };
 
 }  // namespace CanalUx
\ No newline at end of file
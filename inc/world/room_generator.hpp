@@ -5,8 +5,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include "core/constants.hpp"
+#include "world/room.hpp"
 
 namespace CanalUx {
 
@@ -17,28 +21,35 @@ namespace CanalUx {
  * - Land: Walls and terrain (collision)
  * - Scenery: Obstacles, decorations, door blockers
  */
-// Forward declaration
-class Room;
-
 class RoomGenerator {
 public:
     RoomGenerator();
     ~RoomGenerator();
 
-    // Generate tile maps for a room
-    // Returns 2D vectors indexed as [y][x]
-    std::vector<std::vector<int>> generateWater(int width, int height,
-                                                 bool doorLeft, bool doorRight,
-                                                 bool doorTop, bool doorBottom);
+    // Shared, immutable tile map (with collision mask) for a room shape.
+    // Built on first request and memoized - rooms copy it only if they edit it.
+    std::shared_ptr<const std::vector<RoomCell>> getTemplate(int width, int height,
+                                                             bool doorLeft, bool doorRight,
+                                                             bool doorTop, bool doorBottom,
+                                                             bool cleared);
+    
+    // Number of distinct room shapes built so far
+    static int getTemplateCount() { return static_cast<int>(templateCache().size()); }
+    
+    // Fill one layer of a room's tile map
+    // cells is row-major (y * width + x) and already sized width * height
+    void generateWater(std::vector<RoomCell>& cells, int width, int height,
+                       bool doorLeft, bool doorRight,
+                       bool doorTop, bool doorBottom);
     
-    std::vector<std::vector<int>> generateLand(int width, int height,
-                                                bool doorLeft, bool doorRight,
-                                                bool doorTop, bool doorBottom);
+    void generateLand(std::vector<RoomCell>& cells, int width, int height,
+                      bool doorLeft, bool doorRight,
+                      bool doorTop, bool doorBottom);
     
-    std::vector<std::vector<int>> generateScenery(int width, int height,
-                                                   bool doorLeft, bool doorRight,
-                                                   bool doorTop, bool doorBottom,
-                                                   bool cleared);
+    void generateScenery(std::vector<RoomCell>& cells, int width, int height,
+                         bool doorLeft, bool doorRight,
+                         bool doorTop, bool doorBottom,
+                         bool cleared);
     
     // Generate side doors for Nanny boss room (barge spawn points)
     // Creates openings on left and right walls at various Y positions
@@ -50,6 +61,12 @@ public:
     void placeDangerSigns(Room* room, int direction);
 
 private:
+    using TemplateMap = std::unordered_map<uint32_t, std::shared_ptr<const std::vector<RoomCell>>>;
+    
+    // Templates are shared by every generator, so rooms in different levels
+    // (and the level built in the background) reuse them too
+    static TemplateMap& templateCache();
+    
     // Helper to create a single side door opening
     void createSideDoorOpening(Room* room, int doorCenterY, bool isLeftWall);
     // Tile indices for your tileset (all2.png)
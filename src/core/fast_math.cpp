@@ -0,0 +1,28 @@
+/*
+ * CanalUx - Fast Math Implementation
+ */
+
+#include "core/fast_math.hpp"
+
+namespace CanalUx {
+namespace FastMath {
+
+float sinTable[SIN_TABLE_SIZE + 1];
+
+namespace {
+
+// Fills the table before main() - nothing uses FastMath during static
+// initialization
+struct SinTableInit {
+    SinTableInit() {
+        for (int i = 0; i <= SIN_TABLE_SIZE; i++) {
+            sinTable[i] = std::sin(static_cast<double>(i) * 6.283185307179586 / SIN_TABLE_SIZE);
+        }
+    }
+};
+SinTableInit sinTableInit;
+
+}  // namespace
+
+}  // namespace FastMath
+}  // namespace CanalUx
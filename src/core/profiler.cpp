@@ -0,0 +1,111 @@
+/*
+ * CanalUx - Frame Profiler Implementation
+ */
+
+#include "core/profiler.hpp"
+#include <algorithm>
+
+namespace CanalUx {
+
+Profiler::Profiler()
+    : frameStart(0),
+      historyIndex(0),
+      frameCount(0) {
+    current.fill(0.0f);
+}
+
+Profiler::~Profiler() {
+}
+
+void Profiler::beginFrame() {
+    current.fill(0.0f);
+    frameStart = Clock::now();
+}
+
+void Profiler::endFrame() {
+    FrameSample& sample = history[historyIndex];
+    sample.phaseMs = current;
+    sample.totalMs = Clock::elapsedMs(frameStart, Clock::now());
+
+    historyIndex = (historyIndex + 1) % HISTORY_FRAMES;
+    if (frameCount < HISTORY_FRAMES) {
+        frameCount++;
+    }
+}
+
+const char* Profiler::getPhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::INPUT:           return "input";
+        case ProfilePhase::PLAYER:          return "player";
+        case ProfilePhase::PROJECTILES:     return "projectiles";
+        case ProfilePhase::MOBS:            return "mobs";
+        case ProfilePhase::COLLISIONS:      return "collisions";
+        case ProfilePhase::ROOM_CLEAR:      return "room clear";
+        case ProfilePhase::TRANSITIONS:     return "transitions";
+        case ProfilePhase::RENDER_ROOM:     return "draw room";
+        case ProfilePhase::RENDER_ENTITIES: return "draw entities";
+        case ProfilePhase::RENDER_HUD:      return "draw hud";
+        default:                            return "?";
+    }
+}
+
+float Profiler::getPhaseAverageMs(ProfilePhase phase) const {
+    if (frameCount == 0) return 0.0f;
+
+    float sum = 0.0f;
+    for (int i = 0; i < frameCount; i++) {
+        sum += history[i].phaseMs[static_cast<int>(phase)];
+    }
+    return sum / frameCount;
+}
+
+float Profiler::getFrameMinMs() const {
+    if (frameCount == 0) return 0.0f;
+
+    float minMs = history[0].totalMs;
+    for (int i = 1; i < frameCount; i++) {
+        minMs = std::min(minMs, history[i].totalMs);
+    }
+    return minMs;
+}
+
+float Profiler::getFrameAverageMs() const {
+    if (frameCount == 0) return 0.0f;
+
+    float sum = 0.0f;
+    for (int i = 0; i < frameCount; i++) {
+        sum += history[i].totalMs;
+    }
+    return sum / frameCount;
+}
+
+float Profiler::getFramePercentileMs(float percentile) const {
+    if (frameCount == 0) return 0.0f;
+
+    // Small fixed window - sort a copy on the stack
+    std::array<float, HISTORY_FRAMES> totals;
+    for (int i = 0; i < frameCount; i++) {
+        totals[i] = history[i].totalMs;
+    }
+
+    int rank = static_cast<int>(percentile * (frameCount - 1) + 0.5f);
+    rank = std::max(0, std::min(rank, frameCount - 1));
+    std::nth_element(totals.begin(), totals.begin() + rank, totals.begin() + frameCount);
+    return totals[rank];
+}
+
+float Profiler::getLastFrameMs() const {
+    if (frameCount == 0) return 0.0f;
+
+    int last = (historyIndex + HISTORY_FRAMES - 1) % HISTORY_FRAMES;
+    return history[last].totalMs;
+}
+
+float Profiler::getLastPhaseMs(ProfilePhase phase) const {
+    if (frameCount == 0) return 0.0f;
+
+    int last = (historyIndex + HISTORY_FRAMES - 1) % HISTORY_FRAMES;
+    return history[last].phaseMs[static_cast<int>(phase)];
+}
+
+}  // namespace CanalUx
@@ -0,0 +1,210 @@
+/*
+ * CanalUx - Input Replay Implementation
+ */
+
+#include "core/replay.hpp"
+#include <tyra>
+
+namespace CanalUx {
+
+namespace {
+
+constexpr uint32_t REPLAY_MAGIC = 0x50525843;  // "CXRP"
+constexpr uint16_t REPLAY_VERSION = 1;
+constexpr int RUNS_PER_FLUSH = 32;
+
+void writeU8(FILE* file, uint8_t value) {
+    fputc(value, file);
+}
+
+void writeU16(FILE* file, uint16_t value) {
+    writeU8(file, static_cast<uint8_t>(value & 0xFF));
+    writeU8(file, static_cast<uint8_t>(value >> 8));
+}
+
+void writeU32(FILE* file, uint32_t value) {
+    writeU16(file, static_cast<uint16_t>(value & 0xFFFF));
+    writeU16(file, static_cast<uint16_t>(value >> 16));
+}
+
+bool readU8(FILE* file, uint8_t& value) {
+    int c = fgetc(file);
+    if (c == EOF) return false;
+    value = static_cast<uint8_t>(c);
+    return true;
+}
+
+bool readU16(FILE* file, uint16_t& value) {
+    uint8_t lo, hi;
+    if (!readU8(file, lo) || !readU8(file, hi)) return false;
+    value = static_cast<uint16_t>(lo | (hi << 8));
+    return true;
+}
+
+bool readU32(FILE* file, uint32_t& value) {
+    uint16_t lo, hi;
+    if (!readU16(file, lo) || !readU16(file, hi)) return false;
+    value = static_cast<uint32_t>(lo) | (static_cast<uint32_t>(hi) << 16);
+    return true;
+}
+
+}  // namespace
+
+// =============================================================================
+// Recorder
+// =============================================================================
+
+ReplayRecorder::ReplayRecorder()
+    : file(nullptr),
+      runSteps(0),
+      runLength(0),
+      runsSinceFlush(0) {
+}
+
+ReplayRecorder::~ReplayRecorder() {
+    close();
+}
+
+bool ReplayRecorder::open(const std::string& path, const RunSettings& settings) {
+    close();
+
+    file = fopen(path.c_str(), "wb");
+    if (!file) {
+        TYRA_LOG("Replay: Failed to open ", path, " for recording");
+        return false;
+    }
+
+    writeU32(file, REPLAY_MAGIC);
+    writeU16(file, REPLAY_VERSION);
+    writeU8(file, static_cast<uint8_t>(settings.startLevel));
+    writeU8(file, settings.skipToBoss ? 1 : 0);
+    writeU32(file, settings.seed);
+
+    runLength = 0;
+    runsSinceFlush = 0;
+
+    TYRA_LOG("Replay: Recording to ", path);
+    return true;
+}
+
+void ReplayRecorder::close() {
+    if (!file) return;
+
+    flushRun();
+    fclose(file);
+    file = nullptr;
+}
+
+void ReplayRecorder::recordFrame(int steps, const InputFrame& input) {
+    if (!file) return;
+
+    uint8_t frameSteps = static_cast<uint8_t>(steps);
+    if (runLength > 0 && (input != runInput || frameSteps != runSteps || runLength == UINT16_MAX)) {
+        flushRun();
+    }
+
+    runInput = input;
+    runSteps = frameSteps;
+    runLength++;
+}
+
+void ReplayRecorder::flushRun() {
+    if (runLength == 0) return;
+
+    writeU16(file, runLength);
+    writeU8(file, runSteps);
+    writeU8(file, runInput.leftH);
+    writeU8(file, runInput.leftV);
+    writeU8(file, runInput.rightH);
+    writeU8(file, runInput.rightV);
+    writeU16(file, runInput.buttons);
+    runLength = 0;
+
+    // Keep the file usable if the console is switched off mid-run
+    if (++runsSinceFlush >= RUNS_PER_FLUSH) {
+        fflush(file);
+        runsSinceFlush = 0;
+    }
+}
+
+// =============================================================================
+// Player
+// =============================================================================
+
+ReplayPlayer::ReplayPlayer()
+    : file(nullptr),
+      runSteps(0),
+      runRemaining(0) {
+}
+
+ReplayPlayer::~ReplayPlayer() {
+    close();
+}
+
+bool ReplayPlayer::open(const std::string& path) {
+    close();
+
+    file = fopen(path.c_str(), "rb");
+    if (!file) {
+        TYRA_LOG("Replay: Failed to open ", path);
+        return false;
+    }
+
+    uint32_t magic = 0, seed = 0;
+    uint16_t version = 0;
+    uint8_t startLevel = 0, skipToBoss = 0;
+    if (!readU32(file, magic) || !readU16(file, version) || !readU8(file, startLevel) ||
+        !readU8(file, skipToBoss) || !readU32(file, seed) ||
+        magic != REPLAY_MAGIC || version != REPLAY_VERSION) {
+        TYRA_LOG("Replay: ", path, " is not a valid replay");
+        close();
+        return false;
+    }
+
+    settings.seed = seed;
+    settings.startLevel = startLevel;
+    settings.skipToBoss = skipToBoss != 0;
+    runRemaining = 0;
+
+    TYRA_LOG("Replay: Playing ", path, " (seed ", seed, ")");
+    return true;
+}
+
+void ReplayPlayer::close() {
+    if (!file) return;
+
+    fclose(file);
+    file = nullptr;
+}
+
+bool ReplayPlayer::nextFrame(int& steps, InputFrame& input) {
+    if (!file) return false;
+
+    if (runRemaining == 0 && !readRun()) {
+        TYRA_LOG("Replay: Finished");
+        close();
+        return false;
+    }
+
+    runRemaining--;
+    steps = runSteps;
+    input = runInput;
+    return true;
+}
+
+bool ReplayPlayer::readRun() {
+    uint16_t length;
+    InputFrame frame;
+    if (!readU16(file, length) || !readU8(file, runSteps) ||
+        !readU8(file, frame.leftH) || !readU8(file, frame.leftV) ||
+        !readU8(file, frame.rightH) || !readU8(file, frame.rightV) ||
+        !readU16(file, frame.buttons) || length == 0) {
+        return false;
+    }
+
+    runInput = frame;
+    runRemaining = length;
+    return true;
+}
+
+}  // namespace CanalUx
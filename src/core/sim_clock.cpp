@@ -0,0 +1,55 @@
+/*
+ * CanalUx - Simulation Clock Implementation
+ */
+
+#include "core/sim_clock.hpp"
+
+namespace CanalUx {
+
+SimClock::SimClock()
+    : lastTicks(0),
+      stepMs(Constants::SIM_STEP_MS),
+      accumulator(0.0f),
+      frameMs(0.0f),
+      primed(false) {
+}
+
+SimClock::~SimClock() {
+}
+
+void SimClock::reset() {
+    accumulator = 0.0f;
+    primed = false;
+}
+
+int SimClock::beginFrame() {
+    Clock::Ticks nowTicks = Clock::now();
+    
+    if (!primed) {
+        // First frame after a reset - run exactly one step
+        lastTicks = nowTicks;
+        primed = true;
+        frameMs = stepMs;
+        accumulator = 0.0f;
+        return 1;
+    }
+    
+    frameMs = Clock::elapsedMs(lastTicks, nowTicks);
+    lastTicks = nowTicks;
+    accumulator += frameMs;
+    
+    int steps = 0;
+    while (accumulator >= stepMs && steps < Constants::SIM_MAX_STEPS_PER_FRAME) {
+        accumulator -= stepMs;
+        steps++;
+    }
+    
+    // Too far behind - drop the backlog rather than spiral
+    if (accumulator >= stepMs) {
+        accumulator = 0.0f;
+    }
+    
+    return steps;
+}
+
+}  // namespace CanalUx
@@ -0,0 +1,367 @@
+/*
+ * CanalUx - Simulation Implementation
+ */
+
+#include "core/simulation.hpp"
+#include "core/clock.hpp"
+#include "core/random.hpp"
+#include <random>
+
+namespace CanalUx {
+
+RunSettings::RunSettings()
+    : seed(0),
+      startLevel(1),
+      skipToBoss(Constants::Cheats::SKIP_TO_BOSS) {
+    // Cheat: Start at specific level
+    if (Constants::Cheats::START_LEVEL > 0 && Constants::Cheats::START_LEVEL <= Constants::TOTAL_LEVELS) {
+        startLevel = Constants::Cheats::START_LEVEL;
+    }
+}
+
+Simulation::Simulation()
+    : levelLoads(0),
+      state(GameState::MENU),
+      currentLevelNumber(1),
+      profiler(nullptr) {
+}
+
+Simulation::~Simulation() {
+}
+
+void Simulation::start(const RunSettings& runSettings) {
+    settings = runSettings;
+    levelLoads = 0;
+
+    TYRA_LOG("CanalUx: Run seed ", settings.seed);
+
+    startNewGame();
+}
+
+unsigned int Simulation::makeRandomSeed() {
+    // Static counter ensures each call gets a different seed
+    static unsigned int instanceCounter = 0;
+    instanceCounter++;
+
+    // Seed using multiple sources for better randomness on PS2
+    std::random_device rd;
+    unsigned int seed = rd();
+
+    // Mix in time-based value for additional entropy
+    Tyra::Timer timer;
+    timer.prime();
+    seed ^= static_cast<unsigned int>(timer.getTimeDelta() * 1000);
+    seed ^= static_cast<unsigned int>(reinterpret_cast<uintptr_t>(&seed));
+    seed ^= (instanceCounter * 2654435761u);  // Multiply by golden ratio prime
+
+    return seed;
+}
+
+void Simulation::initLevel(int levelNumber) {
+    TYRA_LOG("CanalUx: Initializing level ", levelNumber);
+
+    currentLevelNumber = levelNumber;
+
+    unsigned int levelSeed = levelSeedForLoad(levelLoads);
+    levelLoads++;
+
+    // Use the level built during the boss fight if it matches, finishing
+    // whatever slices are left; otherwise generate it now
+    std::unique_ptr<Level> level;
+    if (pendingLevel && pendingLevel->getLevelNumber() == levelNumber && pendingLevel->getSeed() == levelSeed) {
+        level = std::move(pendingLevel);
+        while (!level->generateStep()) {
+        }
+    } else {
+        retireLevel(pendingLevel);
+        level = std::make_unique<Level>(levelNumber, levelSeed);
+        level->generate();
+    }
+    retireLevel(currentLevel);
+    currentLevel = std::move(level);
+
+    // Reset the player in place
+    if (player) {
+        *player = Player(&input);
+    } else {
+        player = std::make_unique<Player>(&input);
+    }
+
+    // Cheat: Skip to boss room
+    Room* spawnRoom = nullptr;
+    if (settings.skipToBoss) {
+        spawnRoom = currentLevel->getBossRoom();
+        if (spawnRoom) {
+            int bossX, bossY;
+            currentLevel->getBossRoomGridPos(bossX, bossY);
+            currentLevel->setCurrentRoom(bossX, bossY);
+            TYRA_LOG("CHEAT: Skipping to boss room at (", bossX, ", ", bossY, ")");
+        }
+    }
+
+    // Fall back to start room if no boss room or cheat disabled
+    if (!spawnRoom) {
+        spawnRoom = currentLevel->getStartRoom();
+    }
+
+    if (spawnRoom) {
+        player->position.x = spawnRoom->getWidth() / 2.0f - 0.5f;
+        player->position.y = spawnRoom->getHeight() / 2.0f - 0.5f;
+        spawnRoom->setVisited(true);
+
+        TYRA_LOG("Player spawned at (", player->position.x, ", ", player->position.y, ")");
+
+        // Spawn mobs for the room (including boss if boss room)
+        if (settings.skipToBoss && spawnRoom->getType() == RoomType::BOSS) {
+            mobManager.spawnMobsForRoom(spawnRoom, currentLevelNumber,
+                                        currentLevel->getRoomSeed(currentLevel->getCurrentGridX(),
+                                                                  currentLevel->getCurrentGridY()));
+        }
+    }
+
+    // Clear managers for new level (resizing the projectile pool for this
+    // level's boss is the only time it allocates)
+    projectileManager.setCapacity(Constants::PROJECTILE_POOL_CAPACITY[levelNumber - 1]);
+    if (!settings.skipToBoss) {
+        mobManager.clear();
+    }
+
+    snapPreviousPositions();
+
+    TYRA_LOG("CanalUx: Level ", levelNumber, " ready");
+}
+
+unsigned int Simulation::levelSeedForLoad(int loadIndex) const {
+    // Every level load gets its own stream of the run seed, so a replay
+    // regenerates the same layouts and mob spawns
+    return Random::deriveSeed(settings.seed, static_cast<uint32_t>(loadIndex));
+}
+
+void Simulation::retireLevel(std::unique_ptr<Level>& level) {
+    if (!level) return;
+
+    // Only one level is torn down at a time - finish the older one now
+    retiredLevel = std::move(level);
+}
+
+void Simulation::handleInput(const InputFrame& frameInput) {
+    input = frameInput;
+
+    // Handle input based on game state
+    switch (state) {
+        case GameState::PLAYING:
+            if (input.isPressed(InputButton::START)) {
+                setState(GameState::PAUSED);
+            }
+            // Debug: Circle to reset level
+            if (input.isPressed(InputButton::CROSS)) {
+                TYRA_LOG("CanalUx: Resetting level...");
+                startNewGame();
+            }
+
+            if (input.isPressed(InputButton::TRIANGLE)) {
+                TYRA_LOG("CanalUx: advance level...");
+                advanceToNextLevel();
+            }
+            break;
+
+        case GameState::PAUSED:
+            if (input.isPressed(InputButton::START)) {
+                setState(GameState::PLAYING);
+            }
+            break;
+
+        case GameState::GAME_OVER:
+            // Press Cross to restart from level 1
+            if (input.isPressed(InputButton::CROSS)) {
+                TYRA_LOG("CanalUx: Restarting game after death...");
+                startNewGame();
+            }
+            break;
+
+        case GameState::VICTORY:
+            // Press Cross to start a new game
+            if (input.isPressed(InputButton::CROSS)) {
+                TYRA_LOG("CanalUx: Starting new game after victory...");
+                startNewGame();
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+void Simulation::update(float deltaTime) {
+    if (state != GameState::PLAYING) {
+        return;
+    }
+
+    Room* room = currentLevel->getCurrentRoom();
+    if (!room || !player) return;
+
+    // Remember where everything was for render interpolation
+    snapPreviousPositions();
+
+    // Update player
+    {
+        ProfileScope scope(profiler, ProfilePhase::PLAYER);
+        player->update(room, &projectileManager, deltaTime);
+    }
+
+    // Update projectiles
+    {
+        ProfileScope scope(profiler, ProfilePhase::PROJECTILES);
+        projectileManager.update(room, deltaTime);
+    }
+
+    // Update mobs (AI sets velocity, CollisionManager resolves collisions)
+    {
+        ProfileScope scope(profiler, ProfilePhase::MOBS);
+        mobManager.update(room, player.get(), &projectileManager, deltaTime);
+    }
+
+    // Check collisions (handles all entity vs world and entity vs entity)
+    {
+        ProfileScope scope(profiler, ProfilePhase::COLLISIONS);
+        collisionManager.checkCollisions(player.get(), &mobManager, &projectileManager, room, deltaTime);
+    }
+
+    // Check if room is cleared
+    {
+        ProfileScope scope(profiler, ProfilePhase::ROOM_CLEAR);
+        if (mobManager.isRoomCleared() && !room->isCleared()) {
+            room->completeClear();
+            TYRA_LOG("Room cleared!");
+
+            // Check if this was the boss room
+            if (room->getType() == RoomType::BOSS) {
+                onBossDefeated();
+            }
+        }
+    }
+
+    // Check room transitions
+    {
+        ProfileScope scope(profiler, ProfilePhase::TRANSITIONS);
+        checkRoomTransitions();
+    }
+
+    // Check player death
+    if (player->getStats().isDead()) {
+        onPlayerDeath();
+    }
+}
+
+void Simulation::runIdleWork() {
+    if (state == GameState::PLAYING && currentLevel) {
+        if (Constants::LAZY_ROOM_GENERATION && Constants::ROOMS_GENERATED_PER_IDLE_FRAME > 0) {
+            currentLevel->generateNeighbourRooms(Constants::ROOMS_GENERATED_PER_IDLE_FRAME);
+        }
+
+        // Once the boss fight starts, build the level that follows it. A
+        // restart since then changes the seed, so drop a stale one.
+        Room* room = currentLevel->getCurrentRoom();
+        if (room && room->getType() == RoomType::BOSS && currentLevelNumber < Constants::TOTAL_LEVELS) {
+            unsigned int nextSeed = levelSeedForLoad(levelLoads);
+            if (pendingLevel && pendingLevel->getSeed() != nextSeed) {
+                retireLevel(pendingLevel);
+            }
+            if (!pendingLevel) {
+                pendingLevel = std::make_unique<Level>(currentLevelNumber + 1, nextSeed);
+                pendingLevel->beginGeneration();
+            }
+        }
+    }
+
+    // Spend the frame's budget on level building first, then teardown.
+    // Always do at least one slice so both make progress.
+    Clock::Ticks start = Clock::now();
+    do {
+        if (pendingLevel && !pendingLevel->isReady()) {
+            pendingLevel->generateStep();
+        } else if (retiredLevel) {
+            if (retiredLevel->releaseStep()) {
+                retiredLevel.reset();
+            }
+        } else {
+            break;
+        }
+    } while (Clock::elapsedMs(start, Clock::now()) < Constants::LEVEL_BACKGROUND_BUDGET_MS);
+}
+
+void Simulation::checkRoomTransitions() {
+    if (!currentLevel || !player) return;
+
+    if (currentLevel->tryExitRoom(player->position)) {
+        onRoomEnter();
+    }
+}
+
+void Simulation::onRoomEnter() {
+    // Clear projectiles when entering a new room
+    projectileManager.clear();
+
+    // Mark room as visited and spawn mobs
+    Room* room = currentLevel->getCurrentRoom();
+    if (room) {
+        room->setVisited(true);
+        mobManager.spawnMobsForRoom(room, currentLevelNumber,
+                                    currentLevel->getRoomSeed(currentLevel->getCurrentGridX(),
+                                                              currentLevel->getCurrentGridY()));
+    }
+
+    // Player was moved to the entry door - don't interpolate across rooms
+    snapPreviousPositions();
+}
+
+void Simulation::snapPreviousPositions() {
+    if (player) {
+        player->storePreviousPosition();
+    }
+    projectileManager.storePreviousPositions();
+    mobManager.storePreviousPositions();
+}
+
+void Simulation::setState(GameState newState) {
+    TYRA_LOG("CanalUx: State change ", static_cast<int>(state), " -> ", static_cast<int>(newState));
+    state = newState;
+}
+
+void Simulation::startNewGame() {
+    TYRA_LOG("CanalUx: Starting new game");
+
+    if (settings.startLevel != 1) {
+        TYRA_LOG("CHEAT: Starting at level ", settings.startLevel);
+    }
+
+    initLevel(settings.startLevel);
+    setState(GameState::PLAYING);
+}
+
+void Simulation::advanceToNextLevel() {
+    if (currentLevelNumber >= Constants::TOTAL_LEVELS) {
+        TYRA_LOG("CanalUx: All levels complete! Victory!");
+        setState(GameState::VICTORY);
+        return;
+    }
+
+    TYRA_LOG("CanalUx: Advancing to level ", currentLevelNumber + 1);
+    initLevel(currentLevelNumber + 1);
+}
+
+void Simulation::onPlayerDeath() {
+    TYRA_LOG("CanalUx: Player died! Press X to restart.");
+    setState(GameState::GAME_OVER);
+}
+
+void Simulation::onBossDefeated() {
+    TYRA_LOG("CanalUx: Boss defeated!");
+    advanceToNextLevel();
+}
+
+void Simulation::onLevelComplete() {
+    advanceToNextLevel();
+}
+
+}  // namespace CanalUx
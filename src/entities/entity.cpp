@@ -9,6 +9,7 @@ namespace CanalUx {
 
 Entity::Entity()
     : position(0.0f, 0.0f),
+      previousPosition(0.0f, 0.0f),
       velocity(0.0f, 0.0f),
       size(Constants::TILE_SIZE, Constants::TILE_SIZE),
       active(true),
@@ -17,6 +18,7 @@ Entity::Entity()
 
 Entity::Entity(Tyra::Vec2 pos, Tyra::Vec2 sz)
     : position(pos),
+      previousPosition(pos),
       velocity(0.0f, 0.0f),
       size(sz),
       active(true),
@@ -50,6 +52,13 @@ void Entity::clampVelocity(float maxVel) {
     if (velocity.y < -maxVel) velocity.y = -maxVel;
 }
 
+Tyra::Vec2 Entity::getInterpolatedPosition(float alpha) const {
+    return Tyra::Vec2(
+        previousPosition.x + (position.x - previousPosition.x) * alpha,
+        previousPosition.y + (position.y - previousPosition.y) * alpha
+    );
+}
+
 Tyra::Vec2 Entity::getCenter() const {
     return Tyra::Vec2(
         position.x + (size.x / Constants::TILE_SIZE) / 2.0f,
@@ -9,18 +9,19 @@
 
 namespace CanalUx {
 
-Player::Player(Tyra::Pad* t_pad)
+Player::Player(const InputFrame* t_input)
     : Entity(Tyra::Vec2(0.0f, 0.0f), Tyra::Vec2(Constants::PLAYER_SIZE, Constants::PLAYER_SIZE)),
-      pad(t_pad),
+      input(t_input),
       stats(),
+      shootCooldownRemaining(0.0f),
       submergeTimeRemaining(0.0f),
       submergeCooldownRemaining(0.0f),
       invincibilityTimeRemaining(0.0f),
       facing(Direction::DOWN),
       shooting(false),
+      submerged(false),
       baseSpeed(Constants::PLAYER_SPEED),
       shootCooldown(Constants::PLAYER_SHOOT_COOLDOWN) {
-    shootTimer.prime();
 }
 
 Player::~Player() {
@@ -34,16 +35,16 @@ void Player::update(float deltaTime) {
     applyDrag();
 }
 
-void Player::update(Room* currentRoom, ProjectileManager* projectileManager) {
+void Player::update(Room* currentRoom, ProjectileManager* projectileManager, float deltaTime) {
     // Handle all input
     handleMovementInput();
     handleSubmergeInput();
     handleShootingInput(projectileManager);
 
-    // Update timers (using a rough delta - Tyra's timer gives us milliseconds)
-    float deltaTime = 16.67f;  // Approximate 60fps frame time
+    // Update timers
     updateSubmergeState(deltaTime);
     updateInvincibility(deltaTime);
+    updateShootCooldown(deltaTime);
 
     // Apply drag to velocity
     applyDrag();
@@ -51,19 +52,19 @@ void Player::update(Room* currentRoom, ProjectileManager* projectileManager) {
     // Clamp velocity
     clampVelocity();
 
-    // Apply velocity - collision manager will resolve world collisions
-    position.x += velocity.x;
-    position.y += velocity.y;
+    // Apply velocity (tuned per 60 Hz step) - collision manager will resolve world collisions
+    float stepFrames = deltaTime / Constants::SIM_STEP_MS;
+    position.x += velocity.x * stepFrames;
+    position.y += velocity.y * stepFrames;
     // Note: World collision resolution handled by CollisionManager::resolvePlayerWorldCollision()
 }
 
-void Player::update(Room* currentRoom) {
+void Player::update(Room* currentRoom, float deltaTime) {
     // Simplified update without shooting
     handleMovementInput();
     handleSubmergeInput();
 
     // Update timers
-    float deltaTime = 16.67f;
     updateSubmergeState(deltaTime);
     updateInvincibility(deltaTime);
 
@@ -72,29 +73,29 @@ void Player::update(Room* currentRoom) {
     clampVelocity();
 
     // Apply velocity - collision manager will resolve world collisions
-    position.x += velocity.x;
-    position.y += velocity.y;
+    float stepFrames = deltaTime / Constants::SIM_STEP_MS;
+    position.x += velocity.x * stepFrames;
+    position.y += velocity.y * stepFrames;
     // Note: World collision resolution handled by CollisionManager::resolvePlayerWorldCollision()
 }
 
 void Player::handleMovementInput() {
-    const auto& leftJoy = pad->getLeftJoyPad();
     float speed = stats.getSpeed() * Constants::Cheats::SPEED_MULTIPLIER;
 
     // Vertical movement
-    if (leftJoy.v <= 100) {
+    if (input->leftV <= 100) {
         velocity.y = -0.1f * speed;
         facing = Direction::UP;
-    } else if (leftJoy.v >= 200) {
+    } else if (input->leftV >= 200) {
         velocity.y = 0.1f * speed;
         facing = Direction::DOWN;
     }
 
     // Horizontal movement
-    if (leftJoy.h <= 100) {
+    if (input->leftH <= 100) {
         velocity.x = -0.1f * speed;
         facing = Direction::LEFT;
-    } else if (leftJoy.h >= 200) {
+    } else if (input->leftH >= 200) {
         velocity.x = 0.1f * speed;
         facing = Direction::RIGHT;
     }
@@ -103,12 +104,10 @@ void Player::handleMovementInput() {
 void Player::handleShootingInput(ProjectileManager* projectileManager) {
     if (!projectileManager) return;
 
-    const auto& rightJoy = pad->getRightJoyPad();
-    
     // Convert stick values (0-255) to -1.0 to 1.0 range
     // Center is 128, so subtract and divide
-    float stickX = (static_cast<float>(rightJoy.h) - 128.0f) / 128.0f;
-    float stickY = (static_cast<float>(rightJoy.v) - 128.0f) / 128.0f;
+    float stickX = (static_cast<float>(input->rightH) - 128.0f) / 128.0f;
+    float stickY = (static_cast<float>(input->rightV) - 128.0f) / 128.0f;
     
     // Calculate magnitude of stick deflection
     float magnitude = std::sqrt(stickX * stickX + stickY * stickY);
@@ -116,7 +115,7 @@ void Player::handleShootingInput(ProjectileManager* projectileManager) {
     // Deadzone threshold - only shoot if stick is pushed far enough
     const float deadzone = 0.4f;
     
-    if (magnitude > deadzone && shootTimer.getTimeDelta() > stats.getFireRate()) {
+    if (magnitude > deadzone && shootCooldownRemaining <= 0.0f) {
         // Normalize the direction
         float dirX = stickX / magnitude;
         float dirY = stickY / magnitude;
@@ -129,15 +128,17 @@ void Player::handleShootingInput(ProjectileManager* projectileManager) {
             Tyra::Vec2(dirX * speed, dirY * speed),
             stats.getDamage()
         );
-        shootTimer.prime();
+        
+        // Fire rate is in Tyra timer ticks - convert to simulation time
+        shootCooldownRemaining = stats.getFireRate() / Constants::TIMER_TICKS_PER_MS;
     }
 }
 
 void Player::handleSubmergeInput() {
     // R2 trigger to submerge
-    if (pad->getPressed().R2) {
+    if (input->isPressed(InputButton::R2)) {
         trySubmerge();
-    } else if (submerged && !pad->getPressed().R2) {
+    } else if (submerged && !input->isPressed(InputButton::R2)) {
         // Released button - start surfacing
         // For now, instant surface. Could add a delay.
         submerged = false;
@@ -182,6 +183,12 @@ void Player::updateInvincibility(float deltaTime) {
     }
 }
 
+void Player::updateShootCooldown(float deltaTime) {
+    if (shootCooldownRemaining > 0.0f) {
+        shootCooldownRemaining -= deltaTime;
+    }
+}
+
 void Player::takeDamage(int amount) {
     // Cheat: God mode
     if (Constants::Cheats::GOD_MODE) {
@@ -3,8 +3,6 @@
  */
 
 #include "entities/projectile.hpp"
-#include "world/room.hpp"
-#include <cmath>
 
 namespace CanalUx {
 
@@ -38,72 +36,4 @@ Projectile::Projectile(Tyra::Vec2 pos, Tyra::Vec2 vel, float dmg, bool playerOwn
 Projectile::~Projectile() {
 }
 
-void Projectile::update(float deltaTime) {
-    if (!active) return;
-
-    // Apply acceleration if set
-    if (acceleration > 0.0f) {
-        float currentSpeed = std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
-        if (currentSpeed > 0.0f && currentSpeed < maxSpeed) {
-            float newSpeed = currentSpeed + acceleration;
-            if (newSpeed > maxSpeed) newSpeed = maxSpeed;
-            float scale = newSpeed / currentSpeed;
-            velocity.x *= scale;
-            velocity.y *= scale;
-        }
-    }
-
-    // Track distance traveled
-    float dx = velocity.x;
-    float dy = velocity.y;
-    distanceTraveled += std::sqrt(dx * dx + dy * dy);
-
-    // Check if exceeded max range
-    if (distanceTraveled >= maxRange) {
-        destroy();
-        return;
-    }
-
-    // Move projectile
-    position.x += velocity.x;
-    position.y += velocity.y;
-}
-
-void Projectile::update(Room* currentRoom) {
-    if (!active) return;
-
-    // Apply acceleration if set
-    if (acceleration > 0.0f) {
-        float currentSpeed = std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
-        if (currentSpeed > 0.0f && currentSpeed < maxSpeed) {
-            float newSpeed = currentSpeed + acceleration;
-            if (newSpeed > maxSpeed) newSpeed = maxSpeed;
-            float scale = newSpeed / currentSpeed;
-            velocity.x *= scale;
-            velocity.y *= scale;
-        }
-    }
-
-    // Track distance traveled
-    float dx = velocity.x;
-    float dy = velocity.y;
-    distanceTraveled += std::sqrt(dx * dx + dy * dy);
-
-    // Check if exceeded max range
-    if (distanceTraveled >= maxRange) {
-        destroy();
-        return;
-    }
-
-    // Store old position
-    float oldX = position.x;
-    float oldY = position.y;
-
-    // Move projectile
-    position.x += velocity.x;
-    position.y += velocity.y;
-
-    // Note: World collision now handled by CollisionManager::checkProjectileWorldCollision()
-}
-
 }  // namespace CanalUx
\ No newline at end of file
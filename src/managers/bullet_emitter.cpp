@@ -0,0 +1,222 @@
+/*
+ * CanalUx - Bullet Emitter Implementation
+ */
+
+#include "managers/bullet_emitter.hpp"
+#include "core/fast_math.hpp"
+#include "managers/projectile_manager.hpp"
+#include <algorithm>
+
+namespace CanalUx {
+
+// =============================================================================
+// Patterns
+// =============================================================================
+
+BulletPattern BulletPattern::ring(int count, float speed) {
+    BulletPattern pattern;
+    pattern.shape = BulletShape::RING;
+    pattern.count = count;
+    pattern.speed = speed;
+    return pattern;
+}
+
+BulletPattern BulletPattern::arc(int count, float spread, float speed) {
+    BulletPattern pattern;
+    pattern.shape = BulletShape::ARC;
+    pattern.count = count;
+    pattern.spread = spread;
+    pattern.speed = speed;
+    return pattern;
+}
+
+BulletPattern BulletPattern::spiral(int count, float spin, float speed) {
+    BulletPattern pattern;
+    pattern.shape = BulletShape::SPIRAL;
+    pattern.count = count;
+    pattern.spin = spin;
+    pattern.speed = speed;
+    return pattern;
+}
+
+BulletPattern BulletPattern::aimedVolley(int count, float sideSpeed, float speed) {
+    BulletPattern pattern;
+    pattern.shape = BulletShape::AIMED_VOLLEY;
+    pattern.count = count;
+    pattern.spread = sideSpeed;
+    pattern.speed = speed;
+    return pattern;
+}
+
+BulletPattern BulletPattern::wave(int count, float width, float speed) {
+    BulletPattern pattern;
+    pattern.shape = BulletShape::WAVE;
+    pattern.count = count;
+    pattern.spread = width;
+    pattern.speed = speed;
+    return pattern;
+}
+
+// =============================================================================
+// Emitter
+// =============================================================================
+
+BulletEmitter::BulletEmitter() : spinAngle(0) {
+    buildPrototype();
+    buildTables();
+}
+
+BulletEmitter::BulletEmitter(const BulletPattern& t_pattern)
+    : pattern(t_pattern), spinAngle(0) {
+    buildPrototype();
+    buildTables();
+}
+
+void BulletEmitter::setPattern(const BulletPattern& t_pattern) {
+    bool reshaped = t_pattern.shape != pattern.shape || t_pattern.count != pattern.count ||
+                    t_pattern.spread != pattern.spread || t_pattern.speed != pattern.speed;
+    pattern = t_pattern;
+
+    buildPrototype();
+    if (reshaped) {
+        buildTables();
+    }
+}
+
+void BulletEmitter::reserve(int maxCount) {
+    size_t count = static_cast<size_t>(std::max(maxCount, 0));
+    directions.reserve(count);
+    velocities.reserve(count);
+    offsets.reserve(count);
+    spawnPositions.reserve(count);
+    spawnVelocities.reserve(count);
+    ringCache.reserve(count * (count + 1) / 2);
+    ringCached.reserve(count + 1);
+}
+
+void BulletEmitter::prepareRings(int minCount, int maxCount) {
+    reserve(maxCount);
+    for (int count = std::max(minCount, 1); count <= maxCount; count++) {
+        ringDirections(count);
+    }
+}
+
+void BulletEmitter::buildPrototype() {
+    prototype = Projectile(Tyra::Vec2(0.0f, 0.0f), Tyra::Vec2(0.0f, 0.0f), pattern.damage, false);
+    prototype.setMaxRange(pattern.maxRange);
+    prototype.setAcceleration(pattern.acceleration);
+    prototype.setMaxSpeed(pattern.maxSpeed);
+}
+
+void BulletEmitter::buildTables() {
+    int count = std::max(pattern.count, 0);
+
+    // resize keeps capacity - within reserve() this never allocates
+    directions.resize(count);
+    velocities.resize(count);
+    offsets.resize(count);
+    spawnPositions.resize(count);
+    spawnVelocities.resize(count);
+
+    bool fullCircle = pattern.shape == BulletShape::RING || pattern.shape == BulletShape::SPIRAL;
+    const Tyra::Vec2* ring = (fullCircle && count > 0) ? ringDirections(count) : nullptr;
+
+    float centre = (count - 1) / 2.0f;
+    for (int i = 0; i < count; i++) {
+        // Fraction across the volley, 0 to 1 (a single bullet sits in the middle)
+        float t = (count > 1) ? static_cast<float>(i) / (count - 1) : 0.5f;
+
+        switch (pattern.shape) {
+            case BulletShape::RING:
+            case BulletShape::SPIRAL:
+                directions[i] = ring[i];
+                velocities[i] = Tyra::Vec2(ring[i].x * pattern.speed, ring[i].y * pattern.speed);
+                offsets[i] = Tyra::Vec2(0.0f, 0.0f);
+                break;
+            case BulletShape::ARC: {
+                float s, c;
+                FastMath::sinCos(pattern.spread * (t - 0.5f), s, c);
+                directions[i] = Tyra::Vec2(c, s);
+                velocities[i] = Tyra::Vec2(c * pattern.speed, s * pattern.speed);
+                offsets[i] = Tyra::Vec2(0.0f, 0.0f);
+                break;
+            }
+            case BulletShape::AIMED_VOLLEY:
+                directions[i] = Tyra::Vec2(1.0f, 0.0f);
+                velocities[i] = Tyra::Vec2(pattern.speed, (i - centre) * pattern.spread);
+                offsets[i] = Tyra::Vec2(0.0f, 0.0f);
+                break;
+            case BulletShape::WAVE:
+                directions[i] = Tyra::Vec2(1.0f, 0.0f);
+                velocities[i] = Tyra::Vec2(pattern.speed, 0.0f);
+                offsets[i] = Tyra::Vec2(0.0f, pattern.spread * (t - 0.5f));
+                break;
+        }
+    }
+}
+
+const Tyra::Vec2* BulletEmitter::ringDirections(int count) {
+    size_t start = static_cast<size_t>(count) * (count - 1) / 2;
+    if (ringCached.size() <= static_cast<size_t>(count)) {
+        ringCached.resize(count + 1, 0);
+    }
+    if (ringCache.size() < start + count) {
+        ringCache.resize(start + count);
+    }
+
+    if (!ringCached[count]) {
+        for (int i = 0; i < count; i++) {
+            float s, c;
+            FastMath::sinCos((FastMath::TWO_PI / count) * i, s, c);
+            ringCache[start + i] = Tyra::Vec2(c, s);
+        }
+        ringCached[count] = 1;
+    }
+    return &ringCache[start];
+}
+
+void BulletEmitter::advanceSpin() {
+    spinAngle += pattern.spin;
+    if (spinAngle > FastMath::TWO_PI) spinAngle -= FastMath::TWO_PI;
+    if (spinAngle < 0.0f) spinAngle += FastMath::TWO_PI;
+}
+
+int BulletEmitter::fire(ProjectileManager* projectileManager, const Tyra::Vec2& origin, const Tyra::Vec2& aim) {
+    if (pattern.shape != BulletShape::SPIRAL) {
+        return emit(projectileManager, origin, aim.x, aim.y);
+    }
+
+    // Turn the aim by the spiral's angle so far
+    advanceSpin();
+
+    float s, c;
+    FastMath::sinCos(spinAngle, s, c);
+    return emit(projectileManager, origin, aim.x * c - aim.y * s, aim.y * c + aim.x * s);
+}
+
+int BulletEmitter::fire(ProjectileManager* projectileManager, const Tyra::Vec2& origin, float angle) {
+    if (pattern.shape == BulletShape::SPIRAL) {
+        advanceSpin();
+        angle += spinAngle;
+    }
+
+    float s, c;
+    FastMath::sinCos(angle, s, c);
+    return emit(projectileManager, origin, c, s);
+}
+
+int BulletEmitter::emit(ProjectileManager* projectileManager, const Tyra::Vec2& origin, float cosAim, float sinAim) {
+    int count = static_cast<int>(velocities.size());
+    float radius = pattern.spawnRadius;
+    for (int i = 0; i < count; i++) {
+        const Tyra::Vec2& velocity = velocities[i];
+        Tyra::Vec2 offset(offsets[i].x + directions[i].x * radius, offsets[i].y + directions[i].y * radius);
+        spawnVelocities[i] = Tyra::Vec2(cosAim * velocity.x - sinAim * velocity.y,
+                                        sinAim * velocity.x + cosAim * velocity.y);
+        spawnPositions[i] = Tyra::Vec2(origin.x + (cosAim * offset.x - sinAim * offset.y),
+                                       origin.y + (sinAim * offset.x + cosAim * offset.y));
+    }
+    return projectileManager->spawnEnemyVolley(prototype, spawnPositions.data(), spawnVelocities.data(), count);
+}
+
+}  // namespace CanalUx
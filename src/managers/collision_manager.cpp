@@ -12,22 +12,26 @@
 
 namespace CanalUx {
 
-CollisionManager::CollisionManager() {
+CollisionManager::CollisionManager() : stepFrames(1.0f) {
 }
 
 CollisionManager::~CollisionManager() {
 }
 
 // =============================================================================
-// Main collision check - called once per frame
+// Main collision check - called once per simulation step
 // =============================================================================
 
 void CollisionManager::checkCollisions(Player* player, 
                                         MobManager* mobManager,
                                         ProjectileManager* projectileManager,
-                                        Room* currentRoom) {
+                                        Room* currentRoom,
+                                        float deltaTime) {
     if (!currentRoom) return;
     
+    // Movement this step was velocity * stepFrames
+    stepFrames = deltaTime / Constants::SIM_STEP_MS;
+    
     // === World collisions ===
     
     // Player vs world (tiles + obstacles)
@@ -46,7 +50,7 @@ void CollisionManager::checkCollisions(Player* player,
     
     // Projectiles vs world
     if (projectileManager) {
-        for (auto& projectile : projectileManager->getProjectiles()) {
+        for (auto projectile : projectileManager->getProjectiles()) {
             if (projectile.isActive()) {
                 checkProjectileWorldCollision(projectile, currentRoom, projectile.isFromPlayer());
             }
@@ -62,7 +66,7 @@ void CollisionManager::checkCollisions(Player* player,
     
     // Player projectiles vs mobs
     if (projectileManager && mobManager) {
-        checkProjectileMobCollisions(projectileManager, mobManager);
+        checkProjectileMobCollisions(projectileManager, mobManager, currentRoom);
     }
     
     // Enemy projectiles vs player
@@ -86,8 +90,8 @@ void CollisionManager::resolvePlayerWorldCollision(Player* player, Room* room) {
     // Undo position change to test collision properly
     float newX = player->position.x;
     float newY = player->position.y;
-    player->position.x -= player->velocity.x;
-    player->position.y -= player->velocity.y;
+    player->position.x -= player->velocity.x * stepFrames;
+    player->position.y -= player->velocity.y * stepFrames;
     float origX = player->position.x;
     float origY = player->position.y;
     
@@ -108,13 +112,11 @@ void CollisionManager::resolvePlayerWorldCollision(Player* player, Room* room) {
         // Check obstacles separately
         if (!collidedX) {
             Tyra::Vec2 testPos(player->position.x, origY);
-            for (const auto& obs : room->getObstacles()) {
-                if (obs.blocksPlayer && checkAABB(testPos, playerSize, obs.position, obs.size)) {
-                    player->position.x = obs.position.x + obs.size.x;
-                    player->velocity.x = 0;
-                    collidedX = true;
-                    break;
-                }
+            const RoomObstacle* obs = room->findObstacle(testPos, playerSize, ObstacleBlocks::PLAYER);
+            if (obs) {
+                player->position.x = obs->position.x + obs->size.x;
+                player->velocity.x = 0;
+                collidedX = true;
             }
         }
     } else if (player->velocity.x > 0) {
@@ -130,13 +132,11 @@ void CollisionManager::resolvePlayerWorldCollision(Player* player, Room* room) {
         // Check obstacles separately
         if (!collidedX) {
             Tyra::Vec2 testPos(player->position.x, origY);
-            for (const auto& obs : room->getObstacles()) {
-                if (obs.blocksPlayer && checkAABB(testPos, playerSize, obs.position, obs.size)) {
-                    player->position.x = obs.position.x - sizeInTilesX;
-                    player->velocity.x = 0;
-                    collidedX = true;
-                    break;
-                }
+            const RoomObstacle* obs = room->findObstacle(testPos, playerSize, ObstacleBlocks::PLAYER);
+            if (obs) {
+                player->position.x = obs->position.x - sizeInTilesX;
+                player->velocity.x = 0;
+                collidedX = true;
             }
         }
     }
@@ -157,13 +157,11 @@ void CollisionManager::resolvePlayerWorldCollision(Player* player, Room* room) {
         
         // Check obstacles separately
         if (!collidedY) {
-            for (const auto& obs : room->getObstacles()) {
-                if (obs.blocksPlayer && checkAABB(player->position, playerSize, obs.position, obs.size)) {
-                    player->position.y = obs.position.y + obs.size.y;
-                    player->velocity.y = 0;
-                    collidedY = true;
-                    break;
-                }
+            const RoomObstacle* obs = room->findObstacle(player->position, playerSize, ObstacleBlocks::PLAYER);
+            if (obs) {
+                player->position.y = obs->position.y + obs->size.y;
+                player->velocity.y = 0;
+                collidedY = true;
             }
         }
     } else if (player->velocity.y > 0) {
@@ -178,13 +176,11 @@ void CollisionManager::resolvePlayerWorldCollision(Player* player, Room* room) {
         
         // Check obstacles separately
         if (!collidedY) {
-            for (const auto& obs : room->getObstacles()) {
-                if (obs.blocksPlayer && checkAABB(player->position, playerSize, obs.position, obs.size)) {
-                    player->position.y = obs.position.y - sizeInTilesY;
-                    player->velocity.y = 0;
-                    collidedY = true;
-                    break;
-                }
+            const RoomObstacle* obs = room->findObstacle(player->position, playerSize, ObstacleBlocks::PLAYER);
+            if (obs) {
+                player->position.y = obs->position.y - sizeInTilesY;
+                player->velocity.y = 0;
+                collidedY = true;
             }
         }
     }
@@ -198,8 +194,8 @@ void CollisionManager::resolveMobWorldCollision(MobManager::MobData& mob, Room*
     Tyra::Vec2 mobSize(sizeInTilesX, sizeInTilesY);
     
     // Store position before velocity was applied
-    float oldX = mob.position.x - mob.velocity.x;
-    float oldY = mob.position.y - mob.velocity.y;
+    float oldX = mob.position.x - mob.velocity.x * stepFrames;
+    float oldY = mob.position.y - mob.velocity.y * stepFrames;
     
     // --- Check X collision ---
     bool collidedX = false;
@@ -217,13 +213,11 @@ void CollisionManager::resolveMobWorldCollision(MobManager::MobData& mob, Room*
         // Check obstacles separately
         if (!collidedX) {
             Tyra::Vec2 testPos(mob.position.x, oldY);
-            for (const auto& obs : room->getObstacles()) {
-                if (obs.blocksEnemies && checkAABB(testPos, mobSize, obs.position, obs.size)) {
-                    mob.position.x = obs.position.x + obs.size.x;
-                    mob.velocity.x = 0;
-                    collidedX = true;
-                    break;
-                }
+            const RoomObstacle* obs = room->findObstacle(testPos, mobSize, ObstacleBlocks::ENEMIES);
+            if (obs) {
+                mob.position.x = obs->position.x + obs->size.x;
+                mob.velocity.x = 0;
+                collidedX = true;
             }
         }
     } else if (mob.velocity.x > 0) {
@@ -239,13 +233,11 @@ void CollisionManager::resolveMobWorldCollision(MobManager::MobData& mob, Room*
         // Check obstacles separately
         if (!collidedX) {
             Tyra::Vec2 testPos(mob.position.x, oldY);
-            for (const auto& obs : room->getObstacles()) {
-                if (obs.blocksEnemies && checkAABB(testPos, mobSize, obs.position, obs.size)) {
-                    mob.position.x = obs.position.x - sizeInTilesX;
-                    mob.velocity.x = 0;
-                    collidedX = true;
-                    break;
-                }
+            const RoomObstacle* obs = room->findObstacle(testPos, mobSize, ObstacleBlocks::ENEMIES);
+            if (obs) {
+                mob.position.x = obs->position.x - sizeInTilesX;
+                mob.velocity.x = 0;
+                collidedX = true;
             }
         }
     }
@@ -265,13 +257,11 @@ void CollisionManager::resolveMobWorldCollision(MobManager::MobData& mob, Room*
         
         // Check obstacles separately
         if (!collidedY) {
-            for (const auto& obs : room->getObstacles()) {
-                if (obs.blocksEnemies && checkAABB(mob.position, mobSize, obs.position, obs.size)) {
-                    mob.position.y = obs.position.y + obs.size.y;
-                    mob.velocity.y = 0;
-                    collidedY = true;
-                    break;
-                }
+            const RoomObstacle* obs = room->findObstacle(mob.position, mobSize, ObstacleBlocks::ENEMIES);
+            if (obs) {
+                mob.position.y = obs->position.y + obs->size.y;
+                mob.velocity.y = 0;
+                collidedY = true;
             }
         }
     } else if (mob.velocity.y > 0) {
@@ -286,19 +276,17 @@ void CollisionManager::resolveMobWorldCollision(MobManager::MobData& mob, Room*
         
         // Check obstacles separately
         if (!collidedY) {
-            for (const auto& obs : room->getObstacles()) {
-                if (obs.blocksEnemies && checkAABB(mob.position, mobSize, obs.position, obs.size)) {
-                    mob.position.y = obs.position.y - sizeInTilesY;
-                    mob.velocity.y = 0;
-                    collidedY = true;
-                    break;
-                }
+            const RoomObstacle* obs = room->findObstacle(mob.position, mobSize, ObstacleBlocks::ENEMIES);
+            if (obs) {
+                mob.position.y = obs->position.y - sizeInTilesY;
+                mob.velocity.y = 0;
+                collidedY = true;
             }
         }
     }
 }
 
-void CollisionManager::checkProjectileWorldCollision(Projectile& projectile, Room* room, bool isPlayerProjectile) {
+void CollisionManager::checkProjectileWorldCollision(ProjectileRef projectile, Room* room, bool isPlayerProjectile) {
     if (!room || !projectile.isActive()) return;
     
     // IMPORTANT: If projectile ignores walls (e.g., barges), skip wall collision entirely
@@ -308,28 +296,25 @@ void CollisionManager::checkProjectileWorldCollision(Projectile& projectile, Roo
         return;
     }
     
-    float sizeInTiles = projectile.size.x / Constants::TILE_SIZE;
-    int tileX = static_cast<int>(projectile.position.x);
-    int tileY = static_cast<int>(projectile.position.y);
+    Tyra::Vec2 position = projectile.getPosition();
+    float sizeInTiles = projectile.getSize().x / Constants::TILE_SIZE;
+    int tileX = static_cast<int>(position.x);
+    int tileY = static_cast<int>(position.y);
     
-    // Check tile collision (walls always block normal projectiles)
-    if (room->getLandTile(tileX, tileY) != 0 ||
-        room->getLandTile(static_cast<int>(projectile.position.x + sizeInTiles * 0.9f), tileY) != 0 ||
-        room->getLandTile(tileX, static_cast<int>(projectile.position.y + sizeInTiles * 0.9f)) != 0) {
-        projectile.destroy();
-        return;
-    }
+    int farTileX = static_cast<int>(position.x + sizeInTiles * 0.9f);
+    int farTileY = static_cast<int>(position.y + sizeInTiles * 0.9f);
     
-    // Check scenery (doors etc) - always blocks projectiles
-    if (room->getSceneryTile(tileX, tileY) != 0 ||
-        room->getSceneryTile(static_cast<int>(projectile.position.x + sizeInTiles * 0.9f), tileY) != 0 ||
-        room->getSceneryTile(tileX, static_cast<int>(projectile.position.y + sizeInTiles * 0.9f)) != 0) {
+    // Check tiles - walls and scenery (doors etc) always block normal projectiles
+    uint8_t collision = room->getCollision(tileX, tileY) |
+                        room->getCollision(farTileX, tileY) |
+                        room->getCollision(tileX, farTileY);
+    if (collision & CollisionFlags::SOLID) {
         projectile.destroy();
         return;
     }
     
     // Check dynamic obstacles
-    if (checkObstacleCollisionForProjectile(room, projectile.position.x, projectile.position.y, isPlayerProjectile)) {
+    if (checkObstacleCollisionForProjectile(room, position.x, position.y, isPlayerProjectile)) {
         projectile.destroy();
         return;
     }
@@ -365,43 +350,65 @@ void CollisionManager::checkPlayerMobCollisions(Player* player, MobManager* mobM
 }
 
 void CollisionManager::checkProjectileMobCollisions(ProjectileManager* projectileManager, 
-                                                     MobManager* mobManager) {
-    if (!projectileManager || !mobManager) return;
+                                                     MobManager* mobManager, Room* room) {
+    if (!projectileManager || !mobManager || !room) return;
+    
+    auto playerProjectiles = projectileManager->getPlayerProjectiles();
+    if (playerProjectiles.empty()) return;
     
-    auto& projectiles = projectileManager->getProjectiles();
     auto& mobs = mobManager->getMobs();
     
-    for (auto& projectile : projectiles) {
-        if (!projectile.isActive() || !projectile.isFromPlayer()) continue;
+    // Bucket the mobs that can be hit (submerged ones can't) by tile, so
+    // each projectile only tests the mobs around it
+    mobGrid.reset(0.0f, 0.0f, static_cast<float>(room->getWidth()), static_cast<float>(room->getHeight()));
+    for (size_t i = 0; i < mobs.size(); i++) {
+        const auto& mob = mobs[i];
+        if (!mob.active || mob.submerged) continue;
+        mobGrid.insert(static_cast<int>(i), mob.position.x, mob.position.y,
+                       mob.size.x / Constants::TILE_SIZE, mob.size.y / Constants::TILE_SIZE);
+    }
+    if (mobGrid.getCount() == 0) return;
+    
+    Tyra::Vec2 projSize(Constants::PROJECTILE_SIZE / Constants::TILE_SIZE,
+                        Constants::PROJECTILE_SIZE / Constants::TILE_SIZE);
+    
+    for (auto projectile : playerProjectiles) {
+        if (!projectile.isActive()) continue;
         
-        Tyra::Vec2 projSize(Constants::PROJECTILE_SIZE / Constants::TILE_SIZE,
-                            Constants::PROJECTILE_SIZE / Constants::TILE_SIZE);
+        Tyra::Vec2 projPosition = projectile.getPosition();
         
-        for (auto& mob : mobs) {
-            if (!mob.active) continue;
+        // The mob a scan of the whole list would hit first is the lowest
+        // index that overlaps (a mob can be linked from several tiles)
+        int hit = -1;
+        mobGrid.forEachCandidate(projPosition.x, projPosition.y, projSize.x, projSize.y, [&](int index) {
+            if (hit >= 0 && index >= hit) return;
+            
+            const auto& mob = mobs[index];
             
-            // Submerged mobs can't be hit
-            if (mob.submerged) continue;
+            // Killed by an earlier projectile this step
+            if (!mob.active) return;
             
             Tyra::Vec2 mobSizeInTiles(mob.size.x / Constants::TILE_SIZE,
                                        mob.size.y / Constants::TILE_SIZE);
-            
-            if (checkAABB(projectile.position, projSize, mob.position, mobSizeInTiles)) {
-                float damage = projectile.getDamage();
-                
-                // Cheat: One-hit kills
-                if (Constants::Cheats::ONE_HIT_KILLS) {
-                    damage = 9999.0f;
-                }
-                
-                mob.health -= damage;
-                if (mob.health <= 0) {
-                    mob.active = false;
-                }
-                projectile.destroy();
-                break;
+            if (checkAABB(projPosition, projSize, mob.position, mobSizeInTiles)) {
+                hit = index;
             }
+        });
+        if (hit < 0) continue;
+        
+        auto& mob = mobs[hit];
+        float damage = projectile.getDamage();
+        
+        // Cheat: One-hit kills
+        if (Constants::Cheats::ONE_HIT_KILLS) {
+            damage = 9999.0f;
         }
+        
+        mob.health -= damage;
+        if (mob.health <= 0) {
+            mob.active = false;
+        }
+        projectile.destroy();
     }
 }
 
@@ -415,17 +422,17 @@ void CollisionManager::checkProjectilePlayerCollisions(ProjectileManager* projec
     Tyra::Vec2 playerSize(Constants::PLAYER_SIZE / Constants::TILE_SIZE,
                           Constants::PLAYER_SIZE / Constants::TILE_SIZE);
     
-    for (auto& projectile : projectileManager->getProjectiles()) {
-        if (!projectile.isActive() || projectile.isFromPlayer()) continue;
+    for (auto projectile : projectileManager->getEnemyProjectiles()) {
+        if (!projectile.isActive()) continue;
         
         // Skip if player is submerged and this projectile doesn't hit submerged
         if (player->isSubmerged() && !projectile.getHitsSubmerged()) continue;
         
         // Use projectile's actual size (important for barges which are larger)
-        Tyra::Vec2 projSize(projectile.size.x / Constants::TILE_SIZE,
-                            projectile.size.y / Constants::TILE_SIZE);
+        Tyra::Vec2 projSize(projectile.getSize().x / Constants::TILE_SIZE,
+                            projectile.getSize().y / Constants::TILE_SIZE);
         
-        if (checkAABB(projectile.position, projSize, player->position, playerSize)) {
+        if (checkAABB(projectile.getPosition(), projSize, player->position, playerSize)) {
             int damage = static_cast<int>(projectile.getDamage());
             if (damage < 1) damage = 1;
             player->takeDamage(damage);
@@ -440,59 +447,35 @@ void CollisionManager::checkProjectilePlayerCollisions(ProjectileManager* projec
 // =============================================================================
 
 bool CollisionManager::checkTileCollision(Room* room, float x, float y, bool isSubmerged) {
-    int tileX = static_cast<int>(x);
-    int tileY = static_cast<int>(y);
-    
-    // Land tiles (walls) always block
-    if (room->getLandTile(tileX, tileY) != 0) {
-        return true;
-    }
+    uint8_t collision = room->getCollision(static_cast<int>(x), static_cast<int>(y));
     
-    // Scenery tiles (doors) block unless submerged
-    //if (!isSubmerged && room->getSceneryTile(tileX, tileY) != 0) {
-    //    return true;
+    // Land and scenery tiles (walls, doors) block
+    // Scenery could be passable when submerged:
+    //if (isSubmerged && (collision & CollisionFlags::SUBMERGED_PASSABLE)) {
+    //    return false;
     //}
-
-    if (room->getSceneryTile(tileX, tileY) != 0) {
-        return true;
-    }
     
-    return false;
+    return (collision & CollisionFlags::SOLID) != 0;
 }
 
 bool CollisionManager::checkObstacleCollisionForPlayer(Room* room, float x, float y, float width, float height) {
     Tyra::Vec2 pos(x, y);
     Tyra::Vec2 size(width, height);
-    for (const auto& obs : room->getObstacles()) {
-        if (obs.blocksPlayer && checkAABB(pos, size, obs.position, obs.size)) {
-            return true;
-        }
-    }
-    return false;
+    return room->findObstacle(pos, size, ObstacleBlocks::PLAYER) != nullptr;
 }
 
 bool CollisionManager::checkObstacleCollisionForEnemy(Room* room, float x, float y, float width, float height) {
     Tyra::Vec2 pos(x, y);
     Tyra::Vec2 size(width, height);
-    for (const auto& obs : room->getObstacles()) {
-        if (obs.blocksEnemies && checkAABB(pos, size, obs.position, obs.size)) {
-            return true;
-        }
-    }
-    return false;
+    return room->findObstacle(pos, size, ObstacleBlocks::ENEMIES) != nullptr;
 }
 
 bool CollisionManager::checkObstacleCollisionForProjectile(Room* room, float x, float y, bool isPlayerProjectile) {
     // Point check - use tiny size for projectile center
     Tyra::Vec2 pos(x, y);
     Tyra::Vec2 size(0.1f, 0.1f);
-    for (const auto& obs : room->getObstacles()) {
-        bool blocks = isPlayerProjectile ? obs.blocksPlayerShots : obs.blocksEnemyShots;
-        if (blocks && checkAABB(pos, size, obs.position, obs.size)) {
-            return true;
-        }
-    }
-    return false;
+    uint8_t blocks = isPlayerProjectile ? ObstacleBlocks::PLAYER_SHOTS : ObstacleBlocks::ENEMY_SHOTS;
+    return room->findObstacle(pos, size, blocks) != nullptr;
 }
 
 bool CollisionManager::checkAABB(const Tyra::Vec2& pos1, const Tyra::Vec2& size1,
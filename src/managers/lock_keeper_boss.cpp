@@ -0,0 +1,300 @@
+/*
+ * CanalUx - Lock Keeper Boss Implementation
+ */
+
+#include "managers/lock_keeper_boss.hpp"
+#include "core/fast_math.hpp"
+#include "world/room.hpp"
+#include "entities/player.hpp"
+#include "managers/projectile_manager.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace CanalUx {
+
+LockKeeperBoss::LockKeeperBoss()
+    : ringRadius(0), slamPosition(0.0f, 0.0f), trolleyTarget(0.0f, 0.0f),
+      trolleyProgress(0), trolleysThrown(0), shotDirection(0.0f, 0.0f), shotPosition(0.0f, 0.0f) {
+    // The shockwave ring grows from 16 to 48 shots, a count per volley;
+    // warning shots go one at a time
+    shockwave.prepareRings(16, 48);
+    warningShot.reserve(1);
+}
+
+void LockKeeperBoss::reset() {
+    phase = 1;
+    ringRadius = 0;
+    slamPosition = Tyra::Vec2(0.0f, 0.0f);
+    trolleyTarget = Tyra::Vec2(0.0f, 0.0f);
+    trolleyProgress = 0;
+    trolleysThrown = 0;
+    shotDirection = Tyra::Vec2(0.0f, 0.0f);
+    shotPosition = Tyra::Vec2(0.0f, 0.0f);
+}
+
+void LockKeeperBoss::update(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager, SightCache& sightCache, float stepFrames) {
+    /*
+     * LOCK KEEPER BOSS - Level 2
+     * 
+     * A canal lock keeper who walks along the TOP of the arena.
+     * Player is in the water below.
+     * 
+     * ATTACKS:
+     * 1. Slam - Raises arms, slams down creating expanding shockwave ring
+     *    - Player MUST submerge to dodge (instant kill if not submerged when ring hits)
+     * 2. Trolley Throw - Throws shopping trolley that lands as permanent obstacle
+     * 
+     * MECHANICS:
+     * - Lock Keeper walks left/right along top edge
+     * - Arena shrinks over time (walls close in)
+     * - Trolleys reduce playable area
+     * 
+     * PHASES:
+     * Phase 1 (100-60% HP): Slow, mostly slams
+     * Phase 2 (60-30% HP): Faster, adds trolley throws
+     * Phase 3 (<30% HP): Very fast, frequent attacks, arena shrinks faster
+     */
+    
+    float roomWidth = static_cast<float>(room->getWidth());
+    float roomHeight = static_cast<float>(room->getHeight());
+    
+    // Lock Keeper stays at top of room (y = 1)
+    const float bossY = 1.5f;
+    mob.position.y = bossY;
+    
+    // Player distance (horizontal only since boss is at top)
+    float dx = player->position.x - mob.position.x;
+    float distX = std::abs(dx);
+    
+    // Update phase based on health
+    int oldPhase = phase;
+    updatePhase(mob, 0.6f, 0.3f);
+    
+    // Big arena shrink on phase transition
+    if (phase > oldPhase) {
+        if (phase == 2) {
+            // Phase 2: Shrink horizontally by 3 tiles on each side
+            float shrinkAmount = 3.0f;
+            room->shrinkArenaHorizontal(shrinkAmount);
+            
+            // Push player inward if they're in the new barrier zone
+            float newMinX = room->getArenaMinX();
+            float newMaxX = room->getArenaMaxX();
+            if (player->position.x < newMinX) {
+                player->position.x = newMinX + 0.5f;
+            } else if (player->position.x + 1.0f > newMaxX) {
+                player->position.x = newMaxX - 1.5f;
+            }
+        } else if (phase == 3) {
+            // Phase 3: Shrink to minimum fighting space
+            float currentWidth = room->getArenaMaxX() - room->getArenaMinX();
+            float targetWidth = static_cast<float>(Constants::LOCKKEEPER_ROOM_MIN_WIDTH);
+            if (currentWidth > targetWidth) {
+                float shrinkAmount = (currentWidth - targetWidth) / 2.0f;
+                room->shrinkArenaHorizontal(shrinkAmount);
+                
+                // Push player inward if they're in the new barrier zone
+                float newMinX = room->getArenaMinX();
+                float newMaxX = room->getArenaMaxX();
+                if (player->position.x < newMinX) {
+                    player->position.x = newMinX + 0.5f;
+                } else if (player->position.x + 1.0f > newMaxX) {
+                    player->position.x = newMaxX - 1.5f;
+                }
+            }
+        }
+    }
+    
+    // Facing direction
+    mob.facingRight = dx > 0;
+    
+    // Speed increases with phase
+    float walkSpeed = 0.03f + (phase - 1) * 0.015f;
+    
+    mob.stateTimer += stepFrames;
+    if (mob.actionCooldown > 0) mob.actionCooldown -= stepFrames;
+    
+    switch (mob.state) {
+        case MobState::LOCKKEEPER_WALKING: {
+            // Walk along top edge, tracking player
+            if (dx > 1.0f) {
+                mob.position.x += walkSpeed * stepFrames;
+            } else if (dx < -1.0f) {
+                mob.position.x -= walkSpeed * stepFrames;
+            }
+            
+            // Clamp to room bounds
+            mob.position.x = std::max(3.0f, std::min(mob.position.x, roomWidth - 4.0f));
+            
+            // Decide on attack
+            if (mob.actionCooldown <= 0 && distX < 10.0f) {
+                int attackRoll = mob.random.nextInt(100);
+                
+                // Phase 1: 50% slam, 30% shot, 20% cooldown
+                // Phase 2: 40% slam, 30% shot, 25% trolley, 5% cooldown
+                // Phase 3: 35% slam, 35% shot, 28% trolley, 2% cooldown
+                int slamChance = 50 - (phase - 1) * 7;      // 50, 43, 35
+                int shotChance = 30 + (phase - 1) * 2;      // 30, 32, 35
+                int trolleyChance = (phase >= 2) ? 25 + (phase - 2) * 3 : 0;  // 0, 25, 28
+                
+                if (attackRoll < slamChance) {
+                    mob.state = MobState::LOCKKEEPER_WINDUP;
+                    mob.stateTimer = 0;
+                    // Slam expands from bottom of boss sprite
+                    slamPosition.x = mob.position.x + 2.0f;
+                    slamPosition.y = mob.position.y + 4.0f;
+                } else if (attackRoll < slamChance + shotChance) {
+                    // Warning shot - aim at player, fires accelerating projectiles
+                    mob.state = MobState::LOCKKEEPER_SHOT;
+                    mob.stateTimer = 0;
+                    // Calculate direction to player
+                    float aimDx = player->position.x - (mob.position.x + 2.0f);
+                    float aimDy = player->position.y - (mob.position.y + 4.0f);
+                    float aimLen = FastMath::sqrt(aimDx * aimDx + aimDy * aimDy);
+                    if (aimLen > 0.0f) {
+                        shotDirection.x = aimDx / aimLen;
+                        shotDirection.y = aimDy / aimLen;
+                    } else {
+                        shotDirection.x = 0.0f;
+                        shotDirection.y = 1.0f;
+                    }
+                    // Shot starts at bottom center of boss
+                    shotPosition.x = mob.position.x + 2.0f;
+                    shotPosition.y = mob.position.y + 4.0f;
+                } else if (attackRoll < slamChance + shotChance + trolleyChance && trolleysThrown < 6) {
+                    mob.state = MobState::LOCKKEEPER_THROW_WINDUP;
+                    mob.stateTimer = 0;
+                    // Target somewhere in the arena
+                    trolleyTarget.x = room->getArenaMinX() + 2.0f + 
+                        static_cast<float>(mob.random.nextInt(static_cast<int>(room->getArenaMaxX() - room->getArenaMinX() - 4.0f)));
+                    trolleyTarget.y = room->getArenaMinY() + 2.0f +
+                        static_cast<float>(mob.random.nextInt(static_cast<int>(room->getArenaMaxY() - room->getArenaMinY() - 4.0f)));
+                } else {
+                    // Brief cooldown - shorter now
+                    mob.actionCooldown = 15;
+                }
+            }
+            break;
+        }
+        
+        case MobState::LOCKKEEPER_WINDUP: {
+            // Arms raising - telegraph for player to prepare
+            if (mob.stateTimer >= 45) {  // ~0.75 seconds warning
+                mob.state = MobState::LOCKKEEPER_SLAM;
+                mob.stateTimer = 0;
+                ringRadius = 0.0f;
+            }
+            break;
+        }
+        
+        case MobState::LOCKKEEPER_SLAM: {
+            // Expanding ring of projectiles
+            float ringSpeed = 0.12f + phase * 0.02f;  // Speed in tiles per frame
+            ringRadius += ringSpeed * stepFrames;
+            
+            // Spawn projectiles in a ring pattern every few frames
+            if (static_cast<int>(mob.stateTimer) % 3 == 0 && ringRadius > 0.5f) {
+                // Number of projectiles in the ring increases as it expands
+                int numProjectiles = 16 + static_cast<int>(ringRadius * 2);
+                if (numProjectiles > 48) numProjectiles = 48;  // Cap it
+                
+                // Projectiles start on the ring and move outward with it,
+                // with 999 damage (instant kill) - player must submerge to avoid
+                BulletPattern ring = BulletPattern::ring(numProjectiles, ringSpeed);
+                ring.spawnRadius = ringRadius;
+                ring.damage = 999.0f;
+                shockwave.setPattern(ring);
+                shockwave.fire(projectileManager, slamPosition, 0.0f);
+            }
+            
+            // Ring dissipates after reaching edges
+            float maxRadius = std::max(roomWidth, roomHeight);
+            if (ringRadius > maxRadius) {
+                mob.state = MobState::LOCKKEEPER_STUNNED;
+                mob.stateTimer = 0;
+                ringRadius = 0.0f;
+            }
+            break;
+        }
+        
+        case MobState::LOCKKEEPER_THROW_WINDUP: {
+            // Winding up to throw trolley
+            if (mob.stateTimer >= 30) {
+                mob.state = MobState::LOCKKEEPER_THROWING;
+                mob.stateTimer = 0;
+                trolleyProgress = 0.0f;
+            }
+            break;
+        }
+        
+        case MobState::LOCKKEEPER_THROWING: {
+            // Trolley flying through air
+            trolleyProgress += 0.025f * stepFrames;  // Takes ~40 frames to land
+            
+            if (trolleyProgress >= 1.0f) {
+                // Trolley lands - add obstacle to room
+                RoomObstacle trolley;
+                trolley.position = trolleyTarget;
+                trolley.type = 0;  // Trolley type
+                trolley.blocksPlayer = true;      // Player can't walk through
+                trolley.blocksEnemies = false;    // Enemies can walk through
+                trolley.blocksPlayerShots = false;// Player shots pass through
+                trolley.blocksEnemyShots = false; // Enemy shots pass through
+                room->addObstacle(trolley);
+                
+                trolleysThrown++;
+                
+                mob.state = MobState::LOCKKEEPER_STUNNED;
+                mob.stateTimer = 0;
+            }
+            break;
+        }
+        
+        case MobState::LOCKKEEPER_STUNNED: {
+            // Recovery after attack - shorter now
+            int recoveryTime = 45 - (phase - 1) * 10;  // 45, 35, 25 frames
+            if (mob.stateTimer >= recoveryTime) {
+                mob.state = MobState::LOCKKEEPER_WALKING;
+                mob.stateTimer = 0;
+                mob.actionCooldown = 20 - phase * 4;  // 16, 12, 8 frames
+            }
+            break;
+        }
+        
+        case MobState::LOCKKEEPER_SHOT: {
+            // Fire accelerating projectiles at player
+            // Projectiles start slow and speed up, giving player time to react
+            int spawnRate = 6 - phase;  // Spawn every 5/4/3 frames based on phase
+            if (spawnRate < 3) spawnRate = 3;
+            
+            if (static_cast<int>(mob.stateTimer) % spawnRate == 0) {
+                // Spawn accelerating projectile
+                BulletPattern shot = BulletPattern::aimedVolley(1, 0.0f, 0.02f);  // Start very slow
+                shot.damage = 999.0f;
+                shot.maxRange = 25.0f;
+                
+                // Acceleration and max speed increase with phase
+                shot.acceleration = 0.004f + phase * 0.001f;  // 0.005, 0.006, 0.007
+                shot.maxSpeed = 0.25f + phase * 0.05f;        // 0.30, 0.35, 0.40
+                
+                warningShot.setPattern(shot);
+                warningShot.fire(projectileManager, shotPosition, shotDirection);
+            }
+            
+            // Fire for a duration then stop
+            int fireTime = 50 + phase * 15;  // 65, 80, 95 frames
+            if (mob.stateTimer >= fireTime) {
+                mob.state = MobState::LOCKKEEPER_STUNNED;
+                mob.stateTimer = 0;
+            }
+            break;
+        }
+        
+        default:
+            mob.state = MobState::LOCKKEEPER_WALKING;
+            mob.stateTimer = 0;
+            break;
+    }
+}
+
+}  // namespace CanalUx
@@ -0,0 +1,353 @@
+/*
+ * CanalUx - Nanny Boss Implementation
+ */
+
+#include "managers/nanny_boss.hpp"
+#include "core/fast_math.hpp"
+#include "world/room.hpp"
+#include "entities/player.hpp"
+#include "managers/sight_cache.hpp"
+#include "managers/projectile_manager.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace CanalUx {
+
+NannyBoss::NannyBoss()
+    : attackPattern(0), sweepAngle(0), sweepEndAngle(0), gauntletNumber(0), bargeSpawnTimer(0),
+      gauntletStartY(0), gauntlet1Complete(false), gauntlet2Complete(false), waveCounter(0) {
+    // Largest volleys of any phase, and both gauntlets' spiral rings
+    spreadShot.reserve(4);
+    aimedBurst.reserve(2);
+    sweepShot.reserve(1);
+    gauntletSpiral.prepareRings(2, 3);
+}
+
+void NannyBoss::reset() {
+    phase = 1;
+    attackPattern = 0;
+    sweepAngle = 0;
+    sweepEndAngle = 0;
+    gauntletNumber = 0;
+    bargeSpawnTimer = 0;
+    gauntletStartY = 0;
+    gauntlet1Complete = false;
+    gauntlet2Complete = false;
+    waveCounter = 0;
+    gauntletSpiral.resetSpin();
+}
+
+void NannyBoss::update(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager, SightCache& sightCache, float stepFrames) {
+    /*
+     * NANNY BOSS - Level 3
+     * 
+     * Room: Narrow but very tall (14 x 28)
+     * Nanny stays at top of room
+     * 
+     * Normal Phase: Shoots projectiles down at player
+     * 
+     * Gauntlet Phases (at 66% and 33% HP):
+     * - Player teleported to bottom
+     * - Must navigate up while barges cross from sides
+     * - Barges are instant kill (unless submerged)
+     * - Gauntlet 2 is harder (faster barges, shorter intervals)
+     * - Nanny vulnerable after player completes gauntlet
+     */
+    
+    float roomWidth = static_cast<float>(room->getWidth());
+    float roomHeight = static_cast<float>(room->getHeight());
+    
+    // Nanny stays at top of room
+    const float bossY = 2.0f;
+    mob.position.y = bossY;
+    
+    // Center horizontally
+    mob.position.x = roomWidth / 2.0f - 2.0f;  // Centered (4 tiles wide)
+    
+    // Player distance
+    float dx = player->position.x - mob.position.x;
+    float dy = player->position.y - mob.position.y;
+    
+    // Update phase based on health
+    int oldPhase = phase;
+    updatePhase(mob, 0.66f, 0.33f);
+    
+    // Check for gauntlet trigger on phase transition
+    if (phase > oldPhase) {
+        if (phase == 2 && !gauntlet1Complete) {
+            // Start gauntlet 1
+            mob.state = MobState::NANNY_GAUNTLET_START;
+            mob.stateTimer = 0;
+            gauntletNumber = 1;
+        } else if (phase == 3 && !gauntlet2Complete) {
+            // Start gauntlet 2
+            mob.state = MobState::NANNY_GAUNTLET_START;
+            mob.stateTimer = 0;
+            gauntletNumber = 2;
+        }
+    }
+    
+    // Facing direction
+    mob.facingRight = dx > 0;
+    
+    mob.stateTimer += stepFrames;
+    if (mob.actionCooldown > 0) mob.actionCooldown -= stepFrames;
+    
+    switch (mob.state) {
+        case MobState::NANNY_IDLE:
+        case MobState::NANNY_ATTACKING: {
+            // Normal attack phase - multiple attack patterns
+            // Phase 1: Easiest (before gauntlet 1)
+            // Phase 2: Medium (after gauntlet 1)
+            // Phase 3: Hardest (after gauntlet 2) - but not overwhelming
+            // Aimed patterns wait until the player is in sight
+            Tyra::Vec2 muzzle(mob.position.x + 2.0f, mob.position.y + 4.0f);
+            if (mob.actionCooldown <= 0 && sightCache.hasLineOfSight(room, muzzle, SightCache::getPlayerCenter(player))) {
+                int attackRoll = mob.random.nextInt(100);
+                float projRange = 40.0f;
+                
+                // Calculate direction to player
+                float aimDx = player->position.x - (mob.position.x + 2.0f);
+                float aimDy = player->position.y - (mob.position.y + 4.0f);
+                float aimLen = FastMath::sqrt(aimDx * aimDx + aimDy * aimDy);
+                if (aimLen < 0.1f) aimLen = 1.0f;  // Prevent division by zero
+                float dirX = aimDx / aimLen;
+                float dirY = aimDy / aimLen;
+                
+                // Per-phase settings - difficulty increases with phase
+                int numSpreadShots, numAimedShots;
+                float projSpeed, spreadAngle, cooldownBase;
+                
+                if (phase == 1) {
+                    // Phase 1: Easy
+                    numSpreadShots = 3;
+                    numAimedShots = 1;
+                    projSpeed = 0.06f;
+                    spreadAngle = 0.3f;
+                    cooldownBase = 55.0f;
+                } else if (phase == 2) {
+                    // Phase 2: Medium
+                    numSpreadShots = 4;
+                    numAimedShots = 2;
+                    projSpeed = 0.07f;
+                    spreadAngle = 0.4f;
+                    cooldownBase = 45.0f;
+                } else {
+                    // Phase 3: Hard but manageable
+                    numSpreadShots = 4;
+                    numAimedShots = 2;
+                    projSpeed = 0.08f;
+                    spreadAngle = 0.45f;
+                    cooldownBase = 40.0f;
+                }
+                
+                if (attackRoll < 40) {
+                    // Pattern 1: Spread shot aimed at player
+                    BulletPattern pattern = BulletPattern::arc(numSpreadShots, spreadAngle, projSpeed);
+                    pattern.maxRange = projRange;
+                    spreadShot.setPattern(pattern);
+                    spreadShot.fire(projectileManager, muzzle, FastMath::atan2(dirY, dirX));
+                    mob.actionCooldown = cooldownBase;
+                    
+                } else if (attackRoll < 70) {
+                    // Pattern 2: Aimed burst at player, drifting apart sideways
+                    BulletPattern pattern = BulletPattern::aimedVolley(numAimedShots, 0.15f, projSpeed);
+                    pattern.maxRange = projRange;
+                    aimedBurst.setPattern(pattern);
+                    aimedBurst.fire(projectileManager, muzzle, Tyra::Vec2(dirX, dirY));
+                    mob.actionCooldown = cooldownBase * 0.8f;
+                    
+                } else {
+                    // Pattern 3: Sweeping arc centered on player
+                    attackPattern = 1;
+                    // Store the base angle toward player for the sweep
+                    float baseAngle = FastMath::atan2(dirY, dirX);
+                    sweepAngle = baseAngle - 0.5f;  // Start sweep left of player
+                    sweepEndAngle = baseAngle + 0.5f;  // End sweep right of player
+                    mob.actionCooldown = 5;
+                }
+            }
+            
+            // Handle sweeping arc attack
+            if (attackPattern == 1) {
+                float projRange = 40.0f;
+                float sweepSpeed = (phase == 1) ? 0.06f : (phase == 2) ? 0.08f : 0.09f;
+                float projSpeed = (phase == 1) ? 0.05f : (phase == 2) ? 0.06f : 0.07f;
+                float fireRate = (phase == 1) ? 6.0f : (phase == 2) ? 5.0f : 4.0f;
+                
+                sweepAngle += sweepSpeed * stepFrames;
+                
+                BulletPattern pattern = BulletPattern::arc(1, 0.0f, projSpeed);
+                pattern.maxRange = projRange;
+                sweepShot.setPattern(pattern);
+                sweepShot.fire(projectileManager, Tyra::Vec2(mob.position.x + 2.0f, mob.position.y + 4.0f), sweepAngle);
+                
+                // End sweep when past the target angle
+                if (sweepAngle > sweepEndAngle) {
+                    attackPattern = 0;
+                    mob.actionCooldown = (phase == 1) ? 70.0f : (phase == 2) ? 55.0f : 45.0f;
+                } else {
+                    mob.actionCooldown = fireRate;
+                }
+            }
+            
+            // Initialize state if just entering
+            if (mob.state == MobState::NANNY_IDLE) {
+                mob.state = MobState::NANNY_ATTACKING;
+                attackPattern = 0;
+            }
+            break;
+        }
+        
+        case MobState::NANNY_GAUNTLET_START: {
+            // Brief pause, then teleport player to bottom
+            if (mob.stateTimer >= 30) {  // 0.5 second warning
+                // Clear any existing projectiles
+                projectileManager->clear();
+                
+                // Teleport player to bottom of room
+                player->position.x = roomWidth / 2.0f - 0.5f;
+                player->position.y = roomHeight - 3.0f;
+                player->velocity.x = 0;
+                player->velocity.y = 0;
+                player->storePreviousPosition();  // Teleport - don't interpolate across the room
+                
+                // Set goal line (player must reach this Y to complete gauntlet)
+                // First door is at Y=16, so goal at Y=12 gives buffer after clearing barges
+                gauntletStartY = bossY + 10.0f;
+                
+                // Reset wave counter, barge timer, and projectile angle
+                bargeSpawnTimer = 0;
+                waveCounter = 0;
+                gauntletSpiral.resetSpin();
+                mob.state = MobState::NANNY_GAUNTLET_ACTIVE;
+                mob.stateTimer = 0;
+            }
+            break;
+        }
+        
+        case MobState::NANNY_GAUNTLET_ACTIVE: {
+            // Continuous streams of barges with gaps
+            // All doors on one side spawn together, creating a wall with holes
+            // Player must find and swim through the gaps
+            
+            float bargeSpeed = (gauntletNumber == 1) ? 
+                Constants::NANNY_BARGE_SPEED_1 : Constants::NANNY_BARGE_SPEED_2;
+            float spawnInterval = (gauntletNumber == 1) ?
+                Constants::NANNY_BARGE_SPAWN_INTERVAL_1 : Constants::NANNY_BARGE_SPAWN_INTERVAL_2;
+            int minGaps = (gauntletNumber == 1) ? 
+                Constants::NANNY_MIN_GAPS_1 : Constants::NANNY_MIN_GAPS_2;
+            
+            bargeSpawnTimer += stepFrames;
+            
+            // Spawn barges at calculated interval to create back-to-back stream
+            if (bargeSpawnTimer >= spawnInterval) {
+                bargeSpawnTimer = 0;
+                
+                // Get side doors from room
+                const auto& sideDoors = room->getSideDoors();
+                
+                if (!sideDoors.empty()) {
+                    // Always spawn from left side (going right)
+                    bool fromLeft = true;
+                    
+                    // Collect doors on the left side
+                    std::vector<int> activeDoorIndices;
+                    for (size_t i = 0; i < sideDoors.size(); i++) {
+                        if (sideDoors[i].isLeftSide == fromLeft) {
+                            activeDoorIndices.push_back(static_cast<int>(i));
+                        }
+                    }
+                    
+                    int numDoors = static_cast<int>(activeDoorIndices.size());
+                    
+                    if (numDoors > 0) {
+                        // Randomly select which doors have gaps
+                        // Ensure at least minGaps doors are skipped
+                        std::vector<bool> hasGap(numDoors, false);
+                        int gapsCreated = 0;
+                        
+                        // Guarantee minimum gaps
+                        while (gapsCreated < minGaps && gapsCreated < numDoors) {
+                            int doorIdx = mob.random.nextInt(numDoors);
+                            if (!hasGap[doorIdx]) {
+                                hasGap[doorIdx] = true;
+                                gapsCreated++;
+                            }
+                        }
+                        
+                        // Spawn barges from doors without gaps
+                        for (int i = 0; i < numDoors; i++) {
+                            if (!hasGap[i]) {
+                                const auto& door = sideDoors[activeDoorIndices[i]];
+                                float bargeY = door.yPosition - 0.5f;
+                                float bargeX = fromLeft ? -3.0f : roomWidth + 1.0f;
+                                float bargeVelX = fromLeft ? bargeSpeed : -bargeSpeed;
+                                
+                                projectileManager->spawnBarge(
+                                    Tyra::Vec2(bargeX, bargeY),
+                                    Tyra::Vec2(bargeVelX, 0),
+                                    999.0f
+                                );
+                            }
+                        }
+                    }
+                }
+            }
+            
+            // Boss shoots projectiles in rotating pattern
+            if (mob.actionCooldown <= 0) {
+                float rotationSpeed = (gauntletNumber == 1) ? 0.5f : 0.7f;
+                int numShots = (gauntletNumber == 1) ? 2 : 3;
+                float projSpeed = (gauntletNumber == 1) ? 0.08f : 0.10f;
+                
+                BulletPattern pattern = BulletPattern::spiral(numShots, rotationSpeed, projSpeed);
+                pattern.maxRange = 50.0f;  // Long range to reach player at bottom of room
+                gauntletSpiral.setPattern(pattern);
+                gauntletSpiral.fire(projectileManager, Tyra::Vec2(mob.position.x + 2.0f, mob.position.y + 2.0f), 0.0f);
+                
+                mob.actionCooldown = (gauntletNumber == 1) ? 20.0f : 12.0f;
+            }
+            
+            // Check if player reached the goal
+            if (player->position.y <= gauntletStartY) {
+                mob.state = MobState::NANNY_GAUNTLET_END;
+                mob.stateTimer = 0;
+                
+                if (gauntletNumber == 1) {
+                    gauntlet1Complete = true;
+                } else {
+                    gauntlet2Complete = true;
+                }
+                
+                projectileManager->clear();
+            }
+            break;
+        }
+        
+        case MobState::NANNY_GAUNTLET_END: {
+            // Brief vulnerable period after gauntlet
+            if (mob.stateTimer >= 120) {  // 2 seconds vulnerable
+                mob.state = MobState::NANNY_ATTACKING;
+                mob.stateTimer = 0;
+            }
+            break;
+        }
+        
+        case MobState::NANNY_STUNNED: {
+            // Recovery
+            if (mob.stateTimer >= 60) {
+                mob.state = MobState::NANNY_ATTACKING;
+                mob.stateTimer = 0;
+            }
+            break;
+        }
+        
+        default:
+            mob.state = MobState::NANNY_IDLE;
+            mob.stateTimer = 0;
+            break;
+    }
+}
+
+}  // namespace CanalUx
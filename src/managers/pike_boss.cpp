@@ -0,0 +1,308 @@
+/*
+ * CanalUx - Pike Boss Implementation
+ */
+
+#include "managers/pike_boss.hpp"
+#include "core/fast_math.hpp"
+#include "world/room.hpp"
+#include "entities/player.hpp"
+#include "managers/projectile_manager.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace CanalUx {
+
+PikeBoss::PikeBoss()
+    : rotation(0), circleAngle(0), chargeSpeed(0), chargeTarget(0.0f, 0.0f), tailSweepAngle(0) {
+    // Phase 3 volleys: 7-shot tail sweep, 14-shot splash (10 and 12 before)
+    tailSweep.reserve(7);
+    splash.prepareRings(10, 14);
+}
+
+void PikeBoss::reset() {
+    phase = 1;
+    rotation = 0;
+    circleAngle = 0;
+    chargeSpeed = 0;
+    chargeTarget = Tyra::Vec2(0.0f, 0.0f);
+    tailSweepAngle = 0;
+}
+
+void PikeBoss::update(MobData& mob, Room* room, Player* player, ProjectileManager* projectileManager, SightCache& sightCache, float stepFrames) {
+    /*
+     * PIKE BOSS - Level 1
+     * 
+     * A giant pike fish that lurks beneath the water.
+     * 
+     * MOVEMENT (always submerged, no damage):
+     * - Circling: Swims in circles around player, repositioning
+     * - Charging: Fast repositioning underwater
+     * 
+     * ATTACKS (surfaces to attack):
+     * 1. Emerging - Bursts out of water to bite player
+     * 2. Tail Sweep - Tail surfaces and sweeps, spawns projectiles
+     * 3. Leap - Jumps completely out, crashes down creating splash
+     * 
+     * PHASES:
+     * Phase 1 (100-60% HP): Emerging attack only, slower
+     * Phase 2 (60-30% HP): Adds Tail Sweep
+     * Phase 3 (<30% HP): Adds Leap attack, faster attack frequency
+     */
+    
+    float dx = player->position.x - mob.position.x;
+    float dy = player->position.y - mob.position.y;
+    float distToPlayer = FastMath::sqrt(dx * dx + dy * dy);
+    
+    float roomWidth = static_cast<float>(room->getWidth());
+    float roomHeight = static_cast<float>(room->getHeight());
+    
+    // Pike size in tiles (96x48 pixels = 3x1.5 tiles)
+    const float pikeTileWidth = 3.0f;
+    const float pikeTileHeight = 1.5f;
+    
+    // Room bounds for pike (accounting for its size and wall thickness)
+    const float minX = 2.5f;
+    const float minY = 2.5f;
+    const float maxX = roomWidth - 2.5f - pikeTileWidth;
+    const float maxY = roomHeight - 2.5f - pikeTileHeight;
+    
+    // Helper lambda to clamp pike position to room bounds
+    auto clampToRoom = [&]() {
+        mob.position.x = std::max(minX, std::min(mob.position.x, maxX));
+        mob.position.y = std::max(minY, std::min(mob.position.y, maxY));
+    };
+    
+    // Update phase based on health
+    updatePhase(mob, 0.6f, 0.3f);
+    
+    // Update facing direction
+    mob.facingRight = dx > 0;
+    
+    switch (mob.state) {
+        case MobState::PIKE_CIRCLING: {
+            // MOVEMENT PHASE - Always submerged, no damage
+            // Circles around player, getting into position for attacks
+            mob.submerged = true;
+            
+            // Circle around the player at a set distance
+            float circleRadius = 4.0f - phase * 0.5f;  // Gets closer in later phases
+            float circleSpeed = 0.015f + (phase - 1) * 0.005f;
+            
+            circleAngle += circleSpeed * stepFrames;
+            if (circleAngle > 6.28f) circleAngle -= 6.28f;
+            
+            // Target position on circle around player
+            float targetX = player->position.x + FastMath::cos(circleAngle) * circleRadius;
+            float targetY = player->position.y + FastMath::sin(circleAngle) * circleRadius;
+            
+            // Clamp target to room bounds
+            targetX = std::max(minX, std::min(targetX, maxX));
+            targetY = std::max(minY, std::min(targetY, maxY));
+            
+            // Move towards target position
+            float tdx = targetX - mob.position.x;
+            float tdy = targetY - mob.position.y;
+            float tdist = FastMath::sqrt(tdx * tdx + tdy * tdy);
+            
+            if (tdist > 0.1f) {
+                mob.position.x += (tdx / tdist) * mob.speed * stepFrames;
+                mob.position.y += (tdy / tdist) * mob.speed * stepFrames;
+            }
+            
+            // Clamp position after movement
+            clampToRoom();
+            
+            // Update rotation to face movement direction
+            rotation = FastMath::atan2(tdy, tdx);
+            
+            // Decide next action when cooldown is ready
+            if (mob.actionCooldown <= 0) {
+                int attackRoll = mob.random.nextInt(100);
+                
+                // Attack frequency increases with phase
+                int attackChance = 50 + phase * 12;  // 62%, 74%, 86%
+                
+                // Only attack if reasonably close to player (good position)
+                bool inGoodPosition = distToPlayer < 5.0f;
+                
+                if (attackRoll < attackChance && inGoodPosition) {
+                    // Time to attack! Choose which attack
+                    // All attacks available from phase 1, but weights change
+                    int attackChoice = mob.random.nextInt(100);
+                    
+                    // Phase 1: 20% leap, 30% tail, 50% emerge
+                    // Phase 2: 25% leap, 35% tail, 40% emerge  
+                    // Phase 3: 30% leap, 40% tail, 30% emerge
+                    int leapChance = 15 + phase * 5;      // 20%, 25%, 30%
+                    int tailChance = 25 + phase * 5;      // 30%, 35%, 40%
+                    // emerge is the remainder
+                    
+                    if (attackChoice < leapChance) {
+                        // Leap attack
+                        mob.state = MobState::PIKE_LEAP;
+                        mob.stateTimer = 0;
+                        chargeTarget = player->position;
+                        mob.submerged = false;
+                    } else if (attackChoice < leapChance + tailChance) {
+                        // Tail sweep
+                        mob.state = MobState::PIKE_TAIL_SWEEP;
+                        mob.stateTimer = 0;
+                        tailSweepAngle = FastMath::atan2(dy, dx);
+                        mob.submerged = false;
+                    } else {
+                        // Emerging bite attack
+                        mob.state = MobState::PIKE_EMERGING;
+                        mob.stateTimer = 0;
+                        mob.submerged = false;
+                    }
+                } else if (!inGoodPosition || attackRoll >= attackChance) {
+                    // Reposition - move to a position near the player
+                    mob.state = MobState::PIKE_CHARGING;
+                    mob.stateTimer = 0;
+                    // Target a position close to player for next attack
+                    float angle = mob.random.nextInt(628) / 100.0f;
+                    float dist = 1.5f + mob.random.nextInt(20) / 10.0f;  // 1.5 to 3.5 tiles from player
+                    chargeTarget.x = player->position.x + FastMath::cos(angle) * dist;
+                    chargeTarget.y = player->position.y + FastMath::sin(angle) * dist;
+                    // Clamp target to room bounds
+                    chargeTarget.x = std::max(minX, std::min(chargeTarget.x, maxX));
+                    chargeTarget.y = std::max(minY, std::min(chargeTarget.y, maxY));
+                    chargeSpeed = 0.08f + phase * 0.02f;
+                }
+                
+                // Cooldown between actions - faster in later phases
+                mob.actionCooldown = 60 - phase * 12;  // 48, 36, 24 frames
+            }
+            break;
+        }
+        
+        case MobState::PIKE_CHARGING: {
+            // REPOSITIONING - Fast underwater movement, no damage
+            mob.submerged = true;
+            
+            float cdx = chargeTarget.x - mob.position.x;
+            float cdy = chargeTarget.y - mob.position.y;
+            float cdist = FastMath::sqrt(cdx * cdx + cdy * cdy);
+            
+            rotation = FastMath::atan2(cdy, cdx);
+            
+            if (cdist > 0.5f && mob.stateTimer < 45) {
+                // Still moving to position
+                mob.position.x += (cdx / cdist) * chargeSpeed * stepFrames;
+                mob.position.y += (cdy / cdist) * chargeSpeed * stepFrames;
+                
+                // Clamp to room bounds
+                clampToRoom();
+            } else {
+                // Reached position, return to circling
+                mob.state = MobState::PIKE_CIRCLING;
+                mob.stateTimer = 0;
+            }
+            break;
+        }
+        
+        case MobState::PIKE_EMERGING: {
+            // ATTACK - Burst straight up out of water at current position
+            mob.submerged = false;
+            
+            if (mob.stateTimer < 10) {
+                // Rising up - brief telegraph, no horizontal movement
+            } else if (mob.stateTimer < 35) {
+                // Head is up and snapping - player needs to have moved away
+                // Very minimal drift towards player (just tracking, not chasing)
+                if (distToPlayer < 1.5f && distToPlayer > 0.1f) {
+                    // Only slight adjustment if player is very close
+                    mob.position.x += (dx / distToPlayer) * 0.01f * stepFrames;
+                    mob.position.y += (dy / distToPlayer) * 0.01f * stepFrames;
+                    clampToRoom();
+                }
+                rotation = FastMath::atan2(dy, dx);
+            } else if (mob.stateTimer < 55) {
+                // Recovery - sinking back down
+            } else {
+                // Go back underwater and circle
+                mob.state = MobState::PIKE_CIRCLING;
+                mob.stateTimer = 0;
+                mob.submerged = true;
+            }
+            break;
+        }
+        
+        case MobState::PIKE_TAIL_SWEEP: {
+            // ATTACK - Tail surfaces and sweeps, spawns projectiles
+            mob.submerged = false;
+            
+            if (mob.stateTimer < 15) {
+                // Wind up - tail rising
+            } else if (mob.stateTimer == 15) {
+                // Release projectiles in an arc from pike center
+                int numProjectiles = 4 + phase;  // 5, 6, 7 projectiles
+                float arcSpread = 1.0f + phase * 0.15f;  // Wider arc in later phases
+                tailSweep.setPattern(BulletPattern::arc(numProjectiles, arcSpread * 2.0f, 0.04f + phase * 0.01f));
+                
+                Tyra::Vec2 projPos = mob.position;
+                projPos.x += 1.5f;  // Center X (half of 3 tile width)
+                projPos.y += 0.75f; // Center Y (half of 1.5 tile height)
+                tailSweep.fire(projectileManager, projPos, tailSweepAngle);
+            } else if (mob.stateTimer > 45) {
+                // Return to circling underwater
+                mob.state = MobState::PIKE_CIRCLING;
+                mob.stateTimer = 0;
+                mob.submerged = true;
+            }
+            break;
+        }
+        
+        case MobState::PIKE_LEAP: {
+            // ATTACK - Jump completely out, crash down with splash
+            mob.submerged = false;
+            
+            if (mob.stateTimer < 25) {
+                // Rising up
+            } else if (mob.stateTimer < 55) {
+                // In the air - arc towards player
+                float progress = (mob.stateTimer - 25) / 30.0f;
+                
+                // Move towards where player was when leap started
+                float ldx = chargeTarget.x - mob.position.x;
+                float ldy = chargeTarget.y - mob.position.y;
+                float ldist = FastMath::sqrt(ldx * ldx + ldy * ldy);
+                
+                if (ldist > 0.2f) {
+                    mob.position.x += (ldx / ldist) * 0.1f * stepFrames;
+                    mob.position.y += (ldy / ldist) * 0.1f * stepFrames;
+                    clampToRoom();
+                }
+            } else if (mob.stateTimer == 55) {
+                // Crash down - spawn splash projectiles in all directions from center of pike
+                // Pike is 3 tiles wide x 1.5 tiles tall, so center is at (1.5, 0.75)
+                int numSplash = 8 + phase * 2;  // 10, 12, 14 projectiles
+                splash.setPattern(BulletPattern::ring(numSplash, 0.03f + phase * 0.01f));
+                
+                Tyra::Vec2 projPos = mob.position;
+                projPos.x += 1.5f;  // Center X (half of 3 tile width)
+                projPos.y += 0.75f; // Center Y (half of 1.5 tile height)
+                splash.fire(projectileManager, projPos, 0.0f);
+            } else if (mob.stateTimer > 85) {
+                // Recovery complete, go underwater
+                mob.state = MobState::PIKE_CIRCLING;
+                mob.stateTimer = 0;
+                mob.submerged = true;
+            }
+            break;
+        }
+        
+        // Legacy states - redirect to circling
+        case MobState::PIKE_SUBMERGED:
+            mob.state = MobState::PIKE_CIRCLING;
+            mob.submerged = true;
+            break;
+            
+        default:
+            mob.state = MobState::PIKE_CIRCLING;
+            mob.submerged = true;
+            break;
+    }
+}
+
+}  // namespace CanalUx
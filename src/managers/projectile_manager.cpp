@@ -3,89 +3,134 @@
  */
 
 #include "managers/projectile_manager.hpp"
+#include "core/constants.hpp"
 #include "world/room.hpp"
+#include <algorithm>
 
 namespace CanalUx {
 
 ProjectileManager::ProjectileManager() {
-    // Reserve some space to avoid frequent reallocations
-    projectiles.reserve(50);
+    setCapacity(Constants::PROJECTILE_POOL_CAPACITY[0]);
 }
 
 ProjectileManager::~ProjectileManager() {
 }
 
-void ProjectileManager::spawnPlayerProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage) {
-    projectiles.emplace_back(position, velocity, damage, true);
+void ProjectileManager::setCapacity(int enemyCapacity, int playerCapacity) {
+    // Handles keep the top index bit for the owner
+    playerShots.setCapacity(std::min(playerCapacity, static_cast<int>(ENEMY_HANDLE_BIT)));
+    enemyShots.setCapacity(std::min(enemyCapacity, static_cast<int>(ENEMY_HANDLE_BIT)));
+
+    stats.capacity = getCapacity();
+    stats.active = 0;
 }
 
-void ProjectileManager::spawnEnemyProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage) {
-    projectiles.emplace_back(position, velocity, damage, false);
+ProjectileHandle ProjectileManager::spawnPlayerProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage) {
+    return addProjectile(Projectile(position, velocity, damage, true));
 }
 
-void ProjectileManager::spawnEnemyProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage, float maxRange) {
-    projectiles.emplace_back(position, velocity, damage, false);
-    projectiles.back().setMaxRange(maxRange);
+ProjectileHandle ProjectileManager::spawnEnemyProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage) {
+    return addProjectile(Projectile(position, velocity, damage, false));
 }
 
-void ProjectileManager::spawnAcceleratingProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage,
-                                                     float acceleration, float maxSpeed, bool fromPlayer) {
-    projectiles.emplace_back(position, velocity, damage, fromPlayer);
-    projectiles.back().setAcceleration(acceleration);
-    projectiles.back().setMaxSpeed(maxSpeed);
-    projectiles.back().setMaxRange(25.0f);  // Longer range for accelerating projectiles
+ProjectileHandle ProjectileManager::spawnEnemyProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage, float maxRange) {
+    Projectile projectile(position, velocity, damage, false);
+    projectile.setMaxRange(maxRange);
+    return addProjectile(projectile);
 }
 
-void ProjectileManager::spawnBarge(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage) {
-    projectiles.emplace_back(position, velocity, damage, false);
-    projectiles.back().size = Tyra::Vec2(96.0f, 32.0f);  // 3 tiles wide, 1 tile tall
-    projectiles.back().setHitsSubmerged(true);   // Barges hit submerged players!
-    projectiles.back().setIgnoresWalls(true);    // Barges pass through walls!
-    projectiles.back().setProjectileType(ProjectileType::BARGE);
-    projectiles.back().setMaxRange(50.0f);       // Long range to cross the room
+ProjectileHandle ProjectileManager::spawnAcceleratingProjectile(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage,
+                                                                float acceleration, float maxSpeed, bool fromPlayer) {
+    Projectile projectile(position, velocity, damage, fromPlayer);
+    projectile.setAcceleration(acceleration);
+    projectile.setMaxSpeed(maxSpeed);
+    projectile.setMaxRange(25.0f);  // Longer range for accelerating projectiles
+    return addProjectile(projectile);
 }
 
-void ProjectileManager::addProjectile(const Projectile& projectile) {
-    projectiles.push_back(projectile);
+ProjectileHandle ProjectileManager::spawnBarge(Tyra::Vec2 position, Tyra::Vec2 velocity, float damage) {
+    Projectile projectile(position, velocity, damage, false);
+    projectile.size = Tyra::Vec2(96.0f, 32.0f);  // 3 tiles wide, 1 tile tall
+    projectile.setHitsSubmerged(true);   // Barges hit submerged players!
+    projectile.setIgnoresWalls(true);    // Barges pass through walls!
+    projectile.setProjectileType(ProjectileType::BARGE);
+    projectile.setMaxRange(50.0f);       // Long range to cross the room
+    return addProjectile(projectile);
 }
 
-void ProjectileManager::update(Room* currentRoom) {
-    for (auto& projectile : projectiles) {
-        projectile.update(currentRoom);
+int ProjectileManager::spawnEnemyVolley(const Projectile& prototype, const Tyra::Vec2* positions,
+                                        const Tyra::Vec2* velocities, int count) {
+    int added = enemyShots.addVolley(prototype, positions, velocities, count);
+
+    stats.overflows += count - added;
+    stats.spawned += added;
+    stats.active = getCount();
+    stats.peak = std::max(stats.peak, stats.active);
+    return added;
+}
+
+ProjectileHandle ProjectileManager::addProjectile(const Projectile& projectile) {
+    bool fromPlayer = projectile.isFromPlayer();
+    ProjectileStore& store = fromPlayer ? playerShots : enemyShots;
+
+    int slot = store.add(projectile);
+    if (slot < 0) {
+        stats.overflows++;
+        return ProjectileHandle();
     }
-    removeDestroyedProjectiles();
+
+    stats.spawned++;
+    stats.active = getCount();
+    stats.peak = std::max(stats.peak, stats.active);
+
+    uint16_t index = static_cast<uint16_t>(fromPlayer ? slot : slot | ENEMY_HANDLE_BIT);
+    return ProjectileHandle(index, store.getGeneration(slot));
 }
 
-void ProjectileManager::clear() {
-    projectiles.clear();
+bool ProjectileManager::isAlive(ProjectileHandle handle) const {
+    if (!handle.isValid()) return false;
+
+    const ProjectileStore& store = (handle.index & ENEMY_HANDLE_BIT) ? enemyShots : playerShots;
+    int slot = handle.index & ~ENEMY_HANDLE_BIT;
+    return slot < store.getCapacity() && store.getGeneration(slot) == handle.generation;
 }
 
-std::vector<Projectile*> ProjectileManager::getPlayerProjectiles() {
-    std::vector<Projectile*> result;
-    for (auto& p : projectiles) {
-        if (p.isFromPlayer() && p.isActive()) {
-            result.push_back(&p);
-        }
-    }
-    return result;
+bool ProjectileManager::tryGet(ProjectileHandle handle, ProjectileRef& projectile) {
+    // A freed slot's packed index is left over from its last projectile, so
+    // only a matching generation makes it safe to follow
+    if (!isAlive(handle)) return false;
+
+    ProjectileStore& store = (handle.index & ENEMY_HANDLE_BIT) ? enemyShots : playerShots;
+    projectile = ProjectileRef(&store, store.getPackedIndex(handle.index & ~ENEMY_HANDLE_BIT));
+    return true;
 }
 
-std::vector<Projectile*> ProjectileManager::getEnemyProjectiles() {
-    std::vector<Projectile*> result;
-    for (auto& p : projectiles) {
-        if (!p.isFromPlayer() && p.isActive()) {
-            result.push_back(&p);
-        }
-    }
-    return result;
+void ProjectileManager::update(Room* currentRoom, float deltaTime) {
+    // Speeds and acceleration are tuned per 60 Hz step
+    float stepFrames = deltaTime / Constants::SIM_STEP_MS;
+    playerShots.integrate(stepFrames);
+    enemyShots.integrate(stepFrames);
+
+    playerShots.removeDestroyed();
+    enemyShots.removeDestroyed();
+    stats.active = getCount();
+}
+
+void ProjectileManager::storePreviousPositions() {
+    playerShots.storePreviousPositions();
+    enemyShots.storePreviousPositions();
+}
+
+void ProjectileManager::clear() {
+    playerShots.clear();
+    enemyShots.clear();
+    stats.active = 0;
 }
 
-void ProjectileManager::removeDestroyedProjectiles() {
-    projectiles.erase(
-        std::remove_if(projectiles.begin(), projectiles.end(),
-            [](const Projectile& p) { return p.isDestroyed(); }),
-        projectiles.end()
-    );
+void ProjectileManager::resetStats() {
+    stats.peak = stats.active;
+    stats.spawned = 0;
+    stats.overflows = 0;
 }
 
-}  // namespace CanalUx
\ No newline at end of file
+}  // namespace CanalUx
@@ -0,0 +1,278 @@
+/*
+ * CanalUx - Projectile Store Implementation
+ */
+
+#include "managers/projectile_store.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace CanalUx {
+
+namespace {
+
+constexpr uint32_t ALIVE = 0xFFFFFFFFu;
+
+// One projectile's step. The SIMD path below must give bit-identical
+// results, so it follows the same operations in the same order.
+inline void integrateOne(float& posX, float& posY, float& velX, float& velY, float& traveled,
+                         float maxRange, float acceleration, float maxSpeed, uint32_t& alive,
+                         float stepFrames) {
+    if (!alive) return;
+
+    // Apply acceleration if set
+    if (acceleration > 0.0f) {
+        float currentSpeed = std::sqrt(velX * velX + velY * velY);
+        if (currentSpeed > 0.0f && currentSpeed < maxSpeed) {
+            float newSpeed = currentSpeed + acceleration * stepFrames;
+            if (newSpeed > maxSpeed) newSpeed = maxSpeed;
+            float scale = newSpeed / currentSpeed;
+            velX *= scale;
+            velY *= scale;
+        }
+    }
+
+    // Track distance traveled
+    float dx = velX * stepFrames;
+    float dy = velY * stepFrames;
+    traveled += std::sqrt(dx * dx + dy * dy);
+
+    // Check if exceeded max range
+    if (traveled >= maxRange) {
+        alive = 0;
+        return;
+    }
+
+    // Move projectile
+    posX += dx;
+    posY += dy;
+}
+
+#if defined(__SSE2__)
+inline __m128 select(__m128 mask, __m128 ifSet, __m128 ifClear) {
+    return _mm_or_ps(_mm_and_ps(mask, ifSet), _mm_andnot_ps(mask, ifClear));
+}
+#endif
+
+}  // namespace
+
+ProjectileStore::ProjectileStore()
+    : count(0) {
+}
+
+void ProjectileStore::setCapacity(int capacity) {
+    capacity = std::max(1, std::min(capacity, static_cast<int>(UINT16_MAX)));
+
+    posX.assign(capacity, 0.0f);
+    posY.assign(capacity, 0.0f);
+    velX.assign(capacity, 0.0f);
+    velY.assign(capacity, 0.0f);
+    traveled.assign(capacity, 0.0f);
+    maxRange.assign(capacity, 0.0f);
+    acceleration.assign(capacity, 0.0f);
+    maxSpeed.assign(capacity, 0.0f);
+    alive.assign(capacity, 0);
+    prevX.assign(capacity, 0.0f);
+    prevY.assign(capacity, 0.0f);
+    info.assign(capacity, ProjectileInfo());
+    slotOf.assign(capacity, 0);
+    count = 0;
+
+    generations.assign(capacity, 1);
+    packedOf.assign(capacity, 0);
+
+    // Hand out low slots first
+    freeSlots.resize(capacity);
+    for (int i = 0; i < capacity; i++) {
+        freeSlots[i] = static_cast<uint16_t>(capacity - 1 - i);
+    }
+}
+
+int ProjectileStore::add(const Projectile& projectile) {
+    if (freeSlots.empty()) {
+        return -1;
+    }
+
+    uint16_t slot = freeSlots.back();
+    freeSlots.pop_back();
+
+    int index = count++;
+    slotOf[index] = slot;
+    packedOf[slot] = static_cast<uint16_t>(index);
+
+    posX[index] = projectile.position.x;
+    posY[index] = projectile.position.y;
+    velX[index] = projectile.velocity.x;
+    velY[index] = projectile.velocity.y;
+    traveled[index] = projectile.getDistanceTraveled();
+    maxRange[index] = projectile.getMaxRange();
+    acceleration[index] = projectile.getAcceleration();
+    maxSpeed[index] = projectile.getMaxSpeed();
+    alive[index] = projectile.isActive() ? ALIVE : 0;
+    prevX[index] = projectile.previousPosition.x;
+    prevY[index] = projectile.previousPosition.y;
+
+    ProjectileInfo& cold = info[index];
+    cold.size = projectile.size;
+    cold.damage = projectile.getDamage();
+    cold.type = projectile.getProjectileType();
+    cold.fromPlayer = projectile.isFromPlayer();
+    cold.hitsSubmerged = projectile.getHitsSubmerged();
+    cold.ignoresWalls = projectile.getIgnoresWalls();
+    return slot;
+}
+
+int ProjectileStore::addVolley(const Projectile& prototype, const Tyra::Vec2* positions,
+                               const Tyra::Vec2* velocities, int volleyCount) {
+    int added = std::min(volleyCount, static_cast<int>(freeSlots.size()));
+
+    ProjectileInfo cold;
+    cold.size = prototype.size;
+    cold.damage = prototype.getDamage();
+    cold.type = prototype.getProjectileType();
+    cold.fromPlayer = prototype.isFromPlayer();
+    cold.hitsSubmerged = prototype.getHitsSubmerged();
+    cold.ignoresWalls = prototype.getIgnoresWalls();
+    uint32_t aliveMask = prototype.isActive() ? ALIVE : 0;
+
+    for (int i = 0; i < added; i++) {
+        uint16_t slot = freeSlots.back();
+        freeSlots.pop_back();
+
+        int index = count++;
+        slotOf[index] = slot;
+        packedOf[slot] = static_cast<uint16_t>(index);
+
+        // A new projectile starts where it is, so it doesn't interpolate in
+        posX[index] = positions[i].x;
+        posY[index] = positions[i].y;
+        velX[index] = velocities[i].x;
+        velY[index] = velocities[i].y;
+        traveled[index] = prototype.getDistanceTraveled();
+        maxRange[index] = prototype.getMaxRange();
+        acceleration[index] = prototype.getAcceleration();
+        maxSpeed[index] = prototype.getMaxSpeed();
+        alive[index] = aliveMask;
+        prevX[index] = positions[i].x;
+        prevY[index] = positions[i].y;
+        info[index] = cold;
+    }
+    return added;
+}
+
+void ProjectileStore::releaseSlot(uint16_t slot) {
+    // Stale handles stop matching (never 0, which marks an invalid handle)
+    generations[slot] = generations[slot] == UINT16_MAX ? 1 : generations[slot] + 1;
+    freeSlots.push_back(slot);
+}
+
+void ProjectileStore::integrate(float stepFrames) {
+    float* __restrict px = posX.data();
+    float* __restrict py = posY.data();
+    float* __restrict vx = velX.data();
+    float* __restrict vy = velY.data();
+    float* __restrict dist = traveled.data();
+    const float* __restrict range = maxRange.data();
+    const float* __restrict accel = acceleration.data();
+    const float* __restrict speedCap = maxSpeed.data();
+    uint32_t* __restrict live = alive.data();
+
+    int i = 0;
+
+#if defined(__SSE2__)
+    // Four projectiles per iteration. Every lane computes every step and
+    // masks pick which results to keep, matching integrateOne's branches.
+    const __m128 step = _mm_set1_ps(stepFrames);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        __m128 liveMask = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(live + i)));
+        if (_mm_movemask_ps(liveMask) == 0) continue;
+
+        __m128 velXs = _mm_loadu_ps(vx + i);
+        __m128 velYs = _mm_loadu_ps(vy + i);
+
+        // Accelerate lanes that are below their speed cap
+        __m128 accels = _mm_loadu_ps(accel + i);
+        __m128 accelMask = _mm_and_ps(liveMask, _mm_cmpgt_ps(accels, zero));
+        if (_mm_movemask_ps(accelMask) != 0) {
+            __m128 caps = _mm_loadu_ps(speedCap + i);
+            __m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(velXs, velXs), _mm_mul_ps(velYs, velYs)));
+            accelMask = _mm_and_ps(accelMask, _mm_and_ps(_mm_cmpgt_ps(speed, zero), _mm_cmplt_ps(speed, caps)));
+
+            __m128 newSpeed = _mm_min_ps(_mm_add_ps(speed, _mm_mul_ps(accels, step)), caps);
+            __m128 scale = _mm_div_ps(newSpeed, speed);
+            velXs = select(accelMask, _mm_mul_ps(velXs, scale), velXs);
+            velYs = select(accelMask, _mm_mul_ps(velYs, scale), velYs);
+            _mm_storeu_ps(vx + i, velXs);
+            _mm_storeu_ps(vy + i, velYs);
+        }
+
+        // Distance this step, range check, then move the survivors
+        __m128 dx = _mm_mul_ps(velXs, step);
+        __m128 dy = _mm_mul_ps(velYs, step);
+        __m128 oldDist = _mm_loadu_ps(dist + i);
+        __m128 newDist = _mm_add_ps(oldDist, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy))));
+        _mm_storeu_ps(dist + i, select(liveMask, newDist, oldDist));
+
+        __m128 expired = _mm_cmpge_ps(newDist, _mm_loadu_ps(range + i));
+        __m128 moveMask = _mm_andnot_ps(expired, liveMask);
+        __m128 oldX = _mm_loadu_ps(px + i);
+        __m128 oldY = _mm_loadu_ps(py + i);
+        _mm_storeu_ps(px + i, select(moveMask, _mm_add_ps(oldX, dx), oldX));
+        _mm_storeu_ps(py + i, select(moveMask, _mm_add_ps(oldY, dy), oldY));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(live + i), _mm_castps_si128(moveMask));
+    }
+#endif
+
+    // Remainder (everything on targets without a SIMD path)
+    for (; i < count; i++) {
+        integrateOne(px[i], py[i], vx[i], vy[i], dist[i], range[i], accel[i], speedCap[i], live[i], stepFrames);
+    }
+}
+
+void ProjectileStore::removeDestroyed() {
+    // Compact the packed arrays in place (keeping spawn order) and return
+    // the destroyed slots to the free stack
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (!alive[i]) {
+            releaseSlot(slotOf[i]);
+            continue;
+        }
+        if (kept != i) {
+            posX[kept] = posX[i];
+            posY[kept] = posY[i];
+            velX[kept] = velX[i];
+            velY[kept] = velY[i];
+            traveled[kept] = traveled[i];
+            maxRange[kept] = maxRange[i];
+            acceleration[kept] = acceleration[i];
+            maxSpeed[kept] = maxSpeed[i];
+            alive[kept] = alive[i];
+            prevX[kept] = prevX[i];
+            prevY[kept] = prevY[i];
+            info[kept] = info[i];
+            slotOf[kept] = slotOf[i];
+            packedOf[slotOf[kept]] = static_cast<uint16_t>(kept);
+        }
+        kept++;
+    }
+    count = kept;
+}
+
+void ProjectileStore::storePreviousPositions() {
+    std::copy(posX.begin(), posX.begin() + count, prevX.begin());
+    std::copy(posY.begin(), posY.begin() + count, prevY.begin());
+}
+
+void ProjectileStore::clear() {
+    for (int i = 0; i < count; i++) {
+        releaseSlot(slotOf[i]);
+    }
+    count = 0;
+}
+
+}  // namespace CanalUx
@@ -0,0 +1,43 @@
+/*
+ * CanalUx - Sight Cache Implementation
+ */
+
+#include "managers/sight_cache.hpp"
+#include "core/constants.hpp"
+#include "world/room.hpp"
+#include "entities/player.hpp"
+#include <cmath>
+
+namespace CanalUx {
+
+SightCache::SightCache() : room(nullptr), revision(0) {
+    entries.reserve(MAX_ENTRIES);
+}
+
+bool SightCache::hasLineOfSight(const Room* t_room, const Tyra::Vec2& from, const Tyra::Vec2& to) {
+    if (t_room != room || t_room->getRevision() != revision) {
+        entries.clear();
+        room = t_room;
+        revision = t_room->getRevision();
+    }
+    
+    int width = room->getWidth();
+    int fromTile = static_cast<int>(std::floor(from.y)) * width + static_cast<int>(std::floor(from.x));
+    int toTile = static_cast<int>(std::floor(to.y)) * width + static_cast<int>(std::floor(to.x));
+    for (const Entry& entry : entries) {
+        if (entry.fromTile == fromTile && entry.toTile == toTile) return entry.visible;
+    }
+    
+    bool visible = room->hasLineOfSight(from, to, ObstacleBlocks::ENEMY_SHOTS);
+    if (entries.size() < MAX_ENTRIES) {
+        entries.push_back({fromTile, toTile, visible});
+    }
+    return visible;
+}
+
+Tyra::Vec2 SightCache::getPlayerCenter(const Player* player) {
+    float half = Constants::PLAYER_SIZE / Constants::TILE_SIZE * 0.5f;
+    return Tyra::Vec2(player->position.x + half, player->position.y + half);
+}
+
+}  // namespace CanalUx
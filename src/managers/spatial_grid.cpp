@@ -0,0 +1,69 @@
+/*
+ * CanalUx - Spatial Grid Implementation
+ */
+
+#include "managers/spatial_grid.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace CanalUx {
+
+SpatialGrid::SpatialGrid()
+    : originX(0), originY(0), columns(0), rows(0) {
+}
+
+void SpatialGrid::reset(float minX, float minY, float maxX, float maxY) {
+    originX = std::floor(minX);
+    originY = std::floor(minY);
+    columns = std::max(1, std::min(MAX_CELLS_PER_SIDE, static_cast<int>(std::floor(maxX) - originX) + 1));
+    rows = std::max(1, std::min(MAX_CELLS_PER_SIDE, static_cast<int>(std::floor(maxY) - originY) + 1));
+
+    heads.assign(columns * rows, -1);
+    links.clear();
+    entries.clear();
+}
+
+SpatialGrid::CellSpan SpatialGrid::getCellSpan(float x, float y, float width, float height) const {
+    // Inclusive on both ends, like Room::getTileSpan - boxes that only touch
+    // still share a cell
+    CellSpan span;
+    span.minX = std::max(0, std::min(columns - 1, static_cast<int>(std::floor(x - originX))));
+    span.minY = std::max(0, std::min(rows - 1, static_cast<int>(std::floor(y - originY))));
+    span.maxX = std::max(0, std::min(columns - 1, static_cast<int>(std::floor(x + width - originX))));
+    span.maxY = std::max(0, std::min(rows - 1, static_cast<int>(std::floor(y + height - originY))));
+    return span;
+}
+
+void SpatialGrid::insert(int id, float x, float y, float width, float height) {
+    if (heads.empty()) return;
+
+    entries.push_back({id, x, y, width, height});
+
+    CellSpan span = getCellSpan(x, y, width, height);
+    for (int cy = span.minY; cy <= span.maxY; cy++) {
+        for (int cx = span.minX; cx <= span.maxX; cx++) {
+            int& head = heads[cy * columns + cx];
+            links.push_back({id, head});
+            head = static_cast<int>(links.size()) - 1;
+        }
+    }
+}
+
+void SpatialGrid::collectAbove(const CellSpan& span, int minId, std::vector<int>& out) const {
+    out.clear();
+    for (int cy = span.minY; cy <= span.maxY; cy++) {
+        for (int cx = span.minX; cx <= span.maxX; cx++) {
+            for (int link = heads[cy * columns + cx]; link >= 0; link = links[link].next) {
+                if (links[link].id > minId) {
+                    out.push_back(links[link].id);
+                }
+            }
+        }
+    }
+
+    // Entities spanning several cells turn up once per shared cell
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+}  // namespace CanalUx
@@ -4,6 +4,7 @@
 
 #include "rendering/entity_renderer.hpp"
 #include "core/camera.hpp"
+#include "core/fast_math.hpp"
 #include "entities/player.hpp"
 #include "managers/projectile_manager.hpp"
 #include "managers/mob_manager.hpp"
@@ -132,19 +133,21 @@ void EntityRenderer::render(Tyra::Renderer2D* renderer,
                             const Player* player,
                             const ProjectileManager* projectileManager,
                             const MobManager* mobManager,
-                            const Room* room) {
+                            const Room* room,
+                            float alpha) {
     // Render order: obstacles, projectiles, mobs, then player (player on top)
     if (room) {
         renderRoomObstacles(renderer, camera, room);
     }
-    renderProjectiles(renderer, camera, projectileManager);
-    renderMobs(renderer, camera, mobManager);
-    renderPlayer(renderer, camera, player);
+    renderProjectiles(renderer, camera, projectileManager, alpha);
+    renderMobs(renderer, camera, mobManager, alpha);
+    renderPlayer(renderer, camera, player, alpha);
 }
 
 void EntityRenderer::renderPlayer(Tyra::Renderer2D* renderer, 
                                    const Camera* camera, 
-                                   const Player* player) {
+                                   const Player* player,
+                                   float alpha) {
     if (!player || !camera) return;
     
     // Skip rendering every other frame when invincible (flash effect)
@@ -157,7 +160,7 @@ void EntityRenderer::renderPlayer(Tyra::Renderer2D* renderer,
         flashCounter = 0;
     }
     
-    Tyra::Vec2 screenPos = camera->worldToScreen(player->position);
+    Tyra::Vec2 screenPos = camera->worldToScreen(player->getInterpolatedPosition(alpha));
     
     // Render submerged sprite if player is underwater
     if (player->isSubmerged()) {
@@ -176,13 +179,14 @@ void EntityRenderer::renderPlayer(Tyra::Renderer2D* renderer,
 
 void EntityRenderer::renderProjectiles(Tyra::Renderer2D* renderer, 
                                         const Camera* camera, 
-                                        const ProjectileManager* projectileManager) {
+                                        const ProjectileManager* projectileManager,
+                                        float alpha) {
     if (!projectileManager || !camera) return;
     
-    for (const auto& projectile : projectileManager->getProjectiles()) {
+    for (auto projectile : projectileManager->getProjectiles()) {
         if (!projectile.isActive()) continue;
         
-        Tyra::Vec2 screenPos = camera->worldToScreen(projectile.position);
+        Tyra::Vec2 screenPos = camera->worldToScreen(projectile.getInterpolatedPosition(alpha));
         
         // Check projectile type for special rendering
         if (projectile.getProjectileType() == ProjectileType::BARGE) {
@@ -196,7 +200,7 @@ void EntityRenderer::renderProjectiles(Tyra::Renderer2D* renderer,
             sprite.position = screenPos;
             
             // Flip sprite if moving right to left
-            if (projectile.velocity.x < 0) {
+            if (projectile.getVelocity().x < 0) {
                 sprite.flipHorizontal = true;
             }
             
@@ -233,7 +237,8 @@ void EntityRenderer::renderProjectiles(Tyra::Renderer2D* renderer,
 
 void EntityRenderer::renderMobs(Tyra::Renderer2D* renderer, 
                                  const Camera* camera, 
-                                 const MobManager* mobManager) {
+                                 const MobManager* mobManager,
+                                 float alpha) {
     if (!mobManager || !camera) return;
     
     // Sprite sheet layout (128x256, 64x64 tiles, VERTICAL):
@@ -246,7 +251,7 @@ void EntityRenderer::renderMobs(Tyra::Renderer2D* renderer,
     for (const auto& mob : mobManager->getMobs()) {
         if (!mob.active) continue;
         
-        Tyra::Vec2 screenPos = camera->worldToScreen(mob.position);
+        Tyra::Vec2 screenPos = camera->worldToScreen(mob.getInterpolatedPosition(alpha));
         
         // Handle Pike boss specially
         if (mob.type == MobType::BOSS_PIKE) {
@@ -256,7 +261,7 @@ void EntityRenderer::renderMobs(Tyra::Renderer2D* renderer,
         
         // Handle Lock Keeper boss specially
         if (mob.type == MobType::BOSS_LOCKKEEPER) {
-            renderLockKeeperBoss(renderer, mob, screenPos, nullptr);
+            renderLockKeeperBoss(renderer, mob, mobManager->getLockKeeperBoss(), screenPos, nullptr);
             continue;
         }
         
@@ -353,8 +358,8 @@ void EntityRenderer::renderPikeBoss(Tyra::Renderer2D* renderer,
             subSprite.size = Tyra::Vec2(64.0f, 64.0f);
             subSprite.position = screenPos;
             // Movement while submerged
-            subSprite.position.x += std::sin(pike.stateTimer * 0.1f) * 2.0f;
-            subSprite.position.y += std::cos(pike.stateTimer * 0.15f) * 1.5f;
+            subSprite.position.x += FastMath::sin(pike.stateTimer * 0.1f) * 2.0f;
+            subSprite.position.y += FastMath::cos(pike.stateTimer * 0.15f) * 1.5f;
             // Charging is faster movement = bigger ripple
             float rippleScale = (pike.state == MobState::PIKE_CHARGING) ? 1.8f : 1.4f;
             subSprite.scale = rippleScale;
@@ -371,7 +376,7 @@ void EntityRenderer::renderPikeBoss(Tyra::Renderer2D* renderer,
             spriteHeight = 128.0f;
             scale = 0.75f;
             // Wiggle side to side while emerging
-            wiggleX = std::sin(pike.stateTimer * 0.3f) * 4.0f;
+            wiggleX = FastMath::sin(pike.stateTimer * 0.3f) * 4.0f;
             // Rise up effect
             if (pike.stateTimer < 10) {
                 sprite.position.y += 20.0f - pike.stateTimer * 2.0f;  // Rising up
@@ -386,7 +391,7 @@ void EntityRenderer::renderPikeBoss(Tyra::Renderer2D* renderer,
             spriteHeight = 128.0f;
             scale = 0.75f;
             // Wiggle back and forth during sweep - more aggressive
-            wiggleX = std::sin(pike.stateTimer * 0.6f) * 8.0f;
+            wiggleX = FastMath::sin(pike.stateTimer * 0.6f) * 8.0f;
             break;
             
         case MobState::PIKE_SUBMERGED:
@@ -397,8 +402,8 @@ void EntityRenderer::renderPikeBoss(Tyra::Renderer2D* renderer,
                 subSprite.mode = Tyra::SpriteMode::MODE_STRETCH;
                 subSprite.size = Tyra::Vec2(64.0f, 64.0f);
                 subSprite.position = screenPos;
-                subSprite.position.x += std::sin(pike.stateTimer * 0.1f) * 2.0f;
-                subSprite.position.y += std::cos(pike.stateTimer * 0.15f) * 1.5f;
+                subSprite.position.x += FastMath::sin(pike.stateTimer * 0.1f) * 2.0f;
+                subSprite.position.y += FastMath::cos(pike.stateTimer * 0.15f) * 1.5f;
                 subSprite.scale = 1.5f;
                 subSprite.color = Tyra::Color(100, 150, 200, 150);
                 renderer->render(subSprite);
@@ -415,7 +420,7 @@ void EntityRenderer::renderPikeBoss(Tyra::Renderer2D* renderer,
             
             // Shadow grows as pike rises, shrinks as it falls
             float leapProgress = pike.stateTimer / 55.0f;  // Matches crash timing
-            float shadowScale = 0.5f + 0.45f * std::sin(std::min(leapProgress, 1.0f) * 3.14159f);
+            float shadowScale = 0.5f + 0.45f * FastMath::sin(std::min(leapProgress, 1.0f) * 3.14159f);
             
             // Shadow base size - wider to match pike body
             float shadowBaseWidth = 180.0f;
@@ -460,7 +465,7 @@ void EntityRenderer::renderPikeBoss(Tyra::Renderer2D* renderer,
             sprite.position.y -= arcHeight;
             
             scale = pikeScale;
-            wiggleX = std::sin(pike.stateTimer * 0.4f) * 2.0f;
+            wiggleX = FastMath::sin(pike.stateTimer * 0.4f) * 2.0f;
             break;
         }
             
@@ -470,7 +475,7 @@ void EntityRenderer::renderPikeBoss(Tyra::Renderer2D* renderer,
             spriteWidth = 256.0f;
             spriteHeight = 128.0f;
             scale = 0.5f;
-            wiggleY = std::sin(pike.stateTimer * 0.15f) * 1.5f;
+            wiggleY = FastMath::sin(pike.stateTimer * 0.15f) * 1.5f;
             break;
     }
     
@@ -493,6 +498,7 @@ void EntityRenderer::renderPikeBoss(Tyra::Renderer2D* renderer,
 
 void EntityRenderer::renderLockKeeperBoss(Tyra::Renderer2D* renderer, 
                                            const MobManager::MobData& lk, 
+                                           const LockKeeperBoss& lkState,
                                            const Tyra::Vec2& screenPos,
                                            const Room* room) {
     (void)room;  // Unused for now
@@ -512,12 +518,12 @@ void EntityRenderer::renderLockKeeperBoss(Tyra::Renderer2D* renderer,
     switch (lk.state) {
         case MobState::LOCKKEEPER_WALKING:
             // Slight bob while walking
-            wiggleX = std::sin(lk.stateTimer * 0.15f) * 3.0f;
+            wiggleX = FastMath::sin(lk.stateTimer * 0.15f) * 3.0f;
             break;
             
         case MobState::LOCKKEEPER_WINDUP:
             // Shake while winding up
-            wiggleX = std::sin(lk.stateTimer * 0.5f) * (lk.stateTimer / 10.0f);
+            wiggleX = FastMath::sin(lk.stateTimer * 0.5f) * (lk.stateTimer / 10.0f);
             // Grow slightly
             scaleModifier = 1.0f + (lk.stateTimer / 45.0f) * 0.1f;
             break;
@@ -539,7 +545,7 @@ void EntityRenderer::renderLockKeeperBoss(Tyra::Renderer2D* renderer,
             
         case MobState::LOCKKEEPER_STUNNED:
             // Slight wobble
-            wiggleX = std::sin(lk.stateTimer * 0.3f) * 2.0f;
+            wiggleX = FastMath::sin(lk.stateTimer * 0.3f) * 2.0f;
             scaleModifier = 0.95f;
             break;
             
@@ -571,18 +577,18 @@ void EntityRenderer::renderLockKeeperBoss(Tyra::Renderer2D* renderer,
         trolley.scale = 0.75f;
         
         // Interpolate position
-        float t = lk.trolleyProgress;
+        float t = lkState.getTrolleyProgress();
         float startX = screenPos.x + 64.0f;
         float startY = screenPos.y + 32.0f;
         
         // Target position - need to convert from world coords
         // Approximate: target is somewhere in the arena
-        float targetX = startX + (lk.trolleyTarget.x - lk.position.x) * Constants::TILE_SIZE;
-        float targetY = startY + (lk.trolleyTarget.y - lk.position.y) * Constants::TILE_SIZE;
+        float targetX = startX + (lkState.getTrolleyTarget().x - lk.position.x) * Constants::TILE_SIZE;
+        float targetY = startY + (lkState.getTrolleyTarget().y - lk.position.y) * Constants::TILE_SIZE;
         
         // Linear interpolation with arc
         trolley.position.x = startX + (targetX - startX) * t;
-        float arcHeight = std::sin(t * 3.14159f) * 80.0f;  // Arc up then down
+        float arcHeight = FastMath::sin(t * 3.14159f) * 80.0f;  // Arc up then down
         trolley.position.y = startY + (targetY - startY) * t - arcHeight;
         
         renderer->render(trolley);
@@ -594,7 +600,7 @@ void EntityRenderer::renderLockKeeperBoss(Tyra::Renderer2D* renderer,
         shadow.size = Tyra::Vec2(64.0f, 32.0f);
         shadow.position.x = trolley.position.x;
         shadow.position.y = startY + (targetY - startY) * t + 20.0f;  // On ground
-        shadow.scale = 0.3f + 0.4f * std::sin(t * 3.14159f);
+        shadow.scale = 0.3f + 0.4f * FastMath::sin(t * 3.14159f);
         shadow.color = Tyra::Color(30, 30, 30, 80);
         
         renderer->render(shadow);
@@ -617,7 +623,7 @@ void EntityRenderer::renderNannyBoss(Tyra::Renderer2D* renderer,
     // Flash red during gauntlet
     if (nanny.state == MobState::NANNY_GAUNTLET_ACTIVE) {
         // Pulsing red tint during gauntlet
-        float pulse = std::sin(nanny.stateTimer * 0.1f) * 0.5f + 0.5f;
+        float pulse = FastMath::sin(nanny.stateTimer * 0.1f) * 0.5f + 0.5f;
         sprite.color = Tyra::Color(255, 100 + pulse * 100, 100 + pulse * 100, 255);
     }
     
@@ -685,18 +691,30 @@ void EntityRenderer::renderRoomObstacles(Tyra::Renderer2D* renderer,
             
             renderer->render(sprite);
         } else if (obstacle.type == 1) {  // Arena barrier / wall
-            // Use a solid colored sprite or a wall tile
+            // Barriers are merged rectangles - draw them a tile at a time,
+            // skipping tiles outside the view
             Tyra::Sprite sprite;
             sprite.id = trolleySprite.id;  // Reuse mobs sheet for now
             sprite.mode = Tyra::SpriteMode::MODE_REPEAT;
-            sprite.size = Tyra::Vec2(obstacle.size.x * Constants::TILE_SIZE, 
-                                     obstacle.size.y * Constants::TILE_SIZE);
+            sprite.size = Tyra::Vec2(Constants::TILE_SIZE, Constants::TILE_SIZE);
             sprite.offset = Tyra::Vec2(0.0f, 224.0f);  // Row 4 or use a different sprite
-            sprite.position = screenPos;
             sprite.scale = 1.0f;
             sprite.color = Tyra::Color(100.0f, 60.0f, 40.0f, 200.0f);  // Brownish tint
             
-            renderer->render(sprite);
+            int tilesX = static_cast<int>(std::ceil(obstacle.size.x));
+            int tilesY = static_cast<int>(std::ceil(obstacle.size.y));
+            for (int ty = 0; ty < tilesY; ty++) {
+                float screenY = screenPos.y + ty * Constants::TILE_SIZE;
+                if (screenY + Constants::TILE_SIZE < 0 || screenY > Constants::SCREEN_HEIGHT) continue;
+                
+                for (int tx = 0; tx < tilesX; tx++) {
+                    float screenX = screenPos.x + tx * Constants::TILE_SIZE;
+                    if (screenX + Constants::TILE_SIZE < 0 || screenX > Constants::SCREEN_WIDTH) continue;
+                    
+                    sprite.position = Tyra::Vec2(screenX, screenY);
+                    renderer->render(sprite);
+                }
+            }
         }
     }
 }
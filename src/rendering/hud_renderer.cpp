@@ -3,6 +3,8 @@
  */
 
 #include "rendering/hud_renderer.hpp"
+#include <cstdio>
+#include "core/profiler.hpp"
 #include "entities/player.hpp"
 #include "world/level.hpp"
 
@@ -190,4 +192,40 @@ void HUDRenderer::renderLevelIndicator(Tyra::Renderer2D* renderer, const Level*
                             2.0f);                        // Scale
 }
 
+void HUDRenderer::renderProfiler(Tyra::Renderer2D* renderer, const Profiler* profiler) {
+    if (!profiler || profiler->getFrameCount() == 0) return;
+    
+    // Left side, below the hearts
+    int textX = 10;
+    int textY = 52;
+    int valueX = textX + 110;
+    int lineHeight = 18;
+    
+    Tyra::Color textColor(255, 255, 255);
+    Tyra::Color shadowColor(0, 0, 0);
+    
+    // Frame summary turns red once the slowest frames miss the step budget
+    float p99 = profiler->getFramePercentileMs(0.99f);
+    Tyra::Color frameColor = p99 > Constants::SIM_STEP_MS ? Tyra::Color(255, 80, 80) : textColor;
+    
+    char line[64];
+    std::snprintf(line, sizeof(line), "frame %.2f ms", profiler->getLastFrameMs());
+    font.drawTextWithShadow(line, textX, textY, frameColor, shadowColor);
+    textY += lineHeight;
+    
+    std::snprintf(line, sizeof(line), "min %.2f avg %.2f p99 %.2f",
+                  profiler->getFrameMinMs(), profiler->getFrameAverageMs(), p99);
+    font.drawTextWithShadow(line, textX, textY, frameColor, shadowColor);
+    textY += lineHeight;
+    
+    // Rolling average per phase
+    for (int i = 0; i < Profiler::PHASE_COUNT; i++) {
+        ProfilePhase phase = static_cast<ProfilePhase>(i);
+        std::snprintf(line, sizeof(line), "%.2f", profiler->getPhaseAverageMs(phase));
+        font.drawTextWithShadow(Profiler::getPhaseName(phase), textX, textY, textColor, shadowColor);
+        font.drawTextWithShadow(line, valueX, textY, textColor, shadowColor);
+        textY += lineHeight;
+    }
+}
+
 }  // namespace CanalUx
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "rendering/room_renderer.hpp"
 #include "world/room.hpp"
 #include "core/camera.hpp"
+#include <algorithm>
 
 namespace CanalUx {
 
@@ -47,31 +48,36 @@ void RoomRenderer::render(Tyra::Renderer2D* renderer, const Room* room, const Ca
     float tileOffsetX = (offsetX - static_cast<int>(offsetX)) * Constants::TILE_SIZE;
     float tileOffsetY = (offsetY - static_cast<int>(offsetY)) * Constants::TILE_SIZE;
     
-    // Render visible tiles
-    for (int x = -1; x < visibleTilesX; x++) {
-        for (int y = -1; y < visibleTilesY; y++) {
-            int tileX = static_cast<int>(offsetX) + x;
-            int tileY = static_cast<int>(offsetY) + y;
-            
-            int screenX = x * Constants::TILE_SIZE - static_cast<int>(tileOffsetX);
-            int screenY = y * Constants::TILE_SIZE - static_cast<int>(tileOffsetY);
+    // Visible tile range, clipped to the room so the inner loop can use
+    // unchecked cell access (tiles outside the room are empty anyway)
+    int firstX = static_cast<int>(offsetX) - 1;
+    int firstY = static_cast<int>(offsetY) - 1;
+    int startX = std::max(firstX, 0);
+    int startY = std::max(firstY, 0);
+    int endX = std::min(static_cast<int>(offsetX) + visibleTilesX, room->getWidth());
+    int endY = std::min(static_cast<int>(offsetY) + visibleTilesY, room->getHeight());
+    
+    // Render visible tiles, walking each row of the tile map in memory order
+    for (int tileY = startY; tileY < endY; tileY++) {
+        int screenY = (tileY - firstY - 1) * Constants::TILE_SIZE - static_cast<int>(tileOffsetY);
+        const RoomCell* cell = &room->cellAt(startX, tileY);
+        
+        for (int tileX = startX; tileX < endX; tileX++, cell++) {
+            int screenX = (tileX - firstX - 1) * Constants::TILE_SIZE - static_cast<int>(tileOffsetX);
             
             // Render water layer (background)
-            int waterTile = room->getWaterTile(tileX, tileY);
-            if (waterTile > 0) {
-                renderer->render(getTileSprite(screenX, screenY, waterTile - 1));
+            if (cell->water > 0) {
+                renderer->render(getTileSprite(screenX, screenY, cell->water - 1));
             }
             
             // Render land layer (walls/terrain)
-            int landTile = room->getLandTile(tileX, tileY);
-            if (landTile > 0) {
-                renderer->render(getTileSprite(screenX, screenY, landTile - 1));
+            if (cell->land > 0) {
+                renderer->render(getTileSprite(screenX, screenY, cell->land - 1));
             }
             
             // Render scenery layer (obstacles, decorations)
-            int sceneryTile = room->getSceneryTile(tileX, tileY);
-            if (sceneryTile > 0) {
-                renderer->render(getTileSprite(screenX, screenY, sceneryTile - 1));
+            if (cell->scenery > 0) {
+                renderer->render(getTileSprite(screenX, screenY, cell->scenery - 1));
             }
         }
     }
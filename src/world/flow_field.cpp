@@ -0,0 +1,141 @@
+/*
+ * CanalUx - Flow Field Implementation
+ */
+
+#include "world/flow_field.hpp"
+#include "world/room.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace CanalUx {
+
+namespace {
+
+// Neighbour offsets - the four straight steps first, so a straight step
+// wins a tie with a diagonal one
+constexpr int STEP_COUNT = 8;
+constexpr int STEP_X[STEP_COUNT] = {1, -1, 0, 0, 1, -1, 1, -1};
+constexpr int STEP_Y[STEP_COUNT] = {0, 0, 1, -1, 1, 1, -1, -1};
+
+}  // namespace
+
+FlowField::FlowField()
+    : room(nullptr), revision(0), targetX(0), targetY(0), width(0), height(0) {
+}
+
+bool FlowField::update(const Room* t_room, int t_targetX, int t_targetY) {
+    if (!t_room) {
+        invalidate();
+        return false;
+    }
+    if (t_room == room && t_room->getRevision() == revision &&
+        t_targetX == targetX && t_targetY == targetY) {
+        return false;
+    }
+
+    room = t_room;
+    revision = room->getRevision();
+    targetX = t_targetX;
+    targetY = t_targetY;
+    rebuild();
+    return true;
+}
+
+uint16_t FlowField::getDistance(int x, int y) const {
+    if (!room || x < 0 || x >= width || y < 0 || y >= height) return UNREACHABLE;
+    return distances[y * width + x];
+}
+
+bool FlowField::getNextTile(int x, int y, int& nextX, int& nextY) const {
+    if (!room || x < 0 || x >= width || y < 0 || y >= height) return false;
+
+    int step = nextStep[y * width + x];
+    if (step < 0) return false;
+
+    nextX = x + STEP_X[step];
+    nextY = y + STEP_Y[step];
+    return true;
+}
+
+void FlowField::markBlocked() {
+    const RoomCell* cells = room->getCells();
+    for (int i = 0; i < width * height; i++) {
+        blocked[i] = (cells[i].collision & CollisionFlags::SOLID) ? 1 : 0;
+    }
+
+    // Only tiles an obstacle actually covers - one ending exactly on a tile
+    // edge leaves the next tile open
+    for (const RoomObstacle& obs : room->getObstacles()) {
+        if (!(obs.getBlocks() & ObstacleBlocks::ENEMIES)) continue;
+
+        int minX = std::max(0, static_cast<int>(std::floor(obs.position.x)));
+        int minY = std::max(0, static_cast<int>(std::floor(obs.position.y)));
+        int maxX = std::min(width, static_cast<int>(std::ceil(obs.position.x + obs.size.x)));
+        int maxY = std::min(height, static_cast<int>(std::ceil(obs.position.y + obs.size.y)));
+        for (int y = minY; y < maxY; y++) {
+            for (int x = minX; x < maxX; x++) {
+                blocked[y * width + x] = 1;
+            }
+        }
+    }
+}
+
+void FlowField::rebuild() {
+    width = room->getWidth();
+    height = room->getHeight();
+    int tileCount = width * height;
+
+    // Same-sized rooms reuse the storage
+    distances.assign(tileCount, UNREACHABLE);
+    nextStep.assign(tileCount, -1);
+    blocked.resize(tileCount);
+    queue.clear();
+    if (tileCount == 0) return;
+
+    markBlocked();
+
+    if (targetX < 0 || targetX >= width || targetY < 0 || targetY >= height) return;
+
+    // Breadth-first over straight steps from the target. The target itself
+    // counts as open even when the player stands somewhere mobs can't.
+    queue.push_back(targetY * width + targetX);
+    distances[queue.back()] = 0;
+    for (size_t head = 0; head < queue.size(); head++) {
+        int index = queue[head];
+        int x = index % width;
+        int y = index / width;
+        uint16_t next = static_cast<uint16_t>(distances[index] + 1);
+        for (int step = 0; step < 4; step++) {
+            int nx = x + STEP_X[step];
+            int ny = y + STEP_Y[step];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+            int neighbour = ny * width + nx;
+            if (blocked[neighbour] || distances[neighbour] != UNREACHABLE) continue;
+            distances[neighbour] = next;
+            queue.push_back(neighbour);
+        }
+    }
+
+    // Each reached tile points at its closest neighbour. Diagonals only when
+    // both tiles beside the corner are open, so mobs don't clip walls.
+    for (int index : queue) {
+        int x = index % width;
+        int y = index / width;
+        uint16_t best = distances[index];
+        for (int step = 0; step < STEP_COUNT; step++) {
+            int nx = x + STEP_X[step];
+            int ny = y + STEP_Y[step];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+            uint16_t distance = distances[ny * width + nx];
+            if (distance >= best) continue;
+            if (step >= 4 && (blocked[y * width + nx] || blocked[ny * width + x])) continue;
+
+            best = distance;
+            nextStep[index] = static_cast<int8_t>(step);
+        }
+    }
+}
+
+}  // namespace CanalUx
@@ -8,8 +8,18 @@
 
 namespace CanalUx {
 
-Level::Level(int lvlNum)
-    : levelNumber(lvlNum),
+Level::Level(int lvlNum, unsigned int levelSeed)
+    : generatedRoomCount(0),
+      generationPhase(GenerationPhase::NOT_STARTED),
+      layoutIterations(0),
+      tileCursor(0),
+      releasedRows(0),
+      approachGridX(-1),
+      approachGridY(-1),
+      approachDoorDir(-1),
+      rng(Random::deriveSeed(levelSeed, 0)),
+      levelNumber(lvlNum),
+      seed(levelSeed),
       roomCount(0),
       targetRoomCount(0),
       currentRoom(nullptr),
@@ -18,64 +28,107 @@ Level::Level(int lvlNum)
       startGridX(GRID_WIDTH / 2),
       startGridY(GRID_HEIGHT / 2) {
     
-    // Static counter ensures each Level instance gets a different seed
-    static unsigned int instanceCounter = 0;
-    instanceCounter++;
-    
-    // Seed RNG using multiple sources for better randomness on PS2
-    std::random_device rd;
-    unsigned int seed = rd();
-    
-    // Mix in time-based value for additional entropy
-    Tyra::Timer timer;
-    timer.prime();
-    seed ^= static_cast<unsigned int>(timer.getTimeDelta() * 1000);
-    seed ^= static_cast<unsigned int>(reinterpret_cast<uintptr_t>(&seed));
-    seed ^= (instanceCounter * 2654435761u);  // Multiply by golden ratio prime
-    
-    rng.seed(seed);
-    
-    TYRA_LOG("Level RNG seed: ", seed, " (instance ", instanceCounter, ")");
+    TYRA_LOG("Level RNG seed: ", seed);
     
     // More rooms as levels progress
     int baseRooms = Constants::MIN_ROOMS_PER_LEVEL;
     int bonusRooms = levelNumber * 2;
-    std::uniform_int_distribution<int> roomDist(baseRooms + bonusRooms, 
-                                                 baseRooms + bonusRooms + 4);
-    targetRoomCount = roomDist(rng);
+    targetRoomCount = rng.nextInt(baseRooms + bonusRooms, baseRooms + bonusRooms + 4);
 }
 
 Level::~Level() {
 }
 
 void Level::generate() {
+    beginGeneration();
+    while (!generateStep()) {
+    }
+}
+
+void Level::beginGeneration() {
     TYRA_LOG("Level ", levelNumber, ": Starting generation (target: ", targetRoomCount, " rooms)");
     
     initializeGrid();
-    generateRoomLayout();
-    assignSpecialRooms();
-    generateRoomTiles();
-    
-    // Set starting position
-    currentGridX = startGridX;
-    currentGridY = startGridY;
-    currentRoom = getRoom(startGridX, startGridY);
-    
-    TYRA_LOG("Level ", levelNumber, ": Generation complete (", roomCount, " rooms)");
-    printDebugMap();
+    placeStartRoom();
+    layoutIterations = 0;
+    tileCursor = 0;
+    generationPhase = GenerationPhase::LAYOUT;
+}
+
+bool Level::generateStep() {
+    switch (generationPhase) {
+        case GenerationPhase::NOT_STARTED:
+            beginGeneration();
+            return false;
+            
+        case GenerationPhase::LAYOUT:
+            // One expansion pass per step
+            if (roomCount < targetRoomCount && !roomQueue.empty() && layoutIterations < 100) {
+                expandLayout();
+                return false;
+            }
+            markEndRooms();
+            generationPhase = GenerationPhase::SPECIAL_ROOMS;
+            return false;
+            
+        case GenerationPhase::SPECIAL_ROOMS:
+            assignSpecialRooms();
+            planRoomSizes();
+            findBossApproach();
+            generationPhase = GenerationPhase::ROOM_TILES;
+            return false;
+            
+        case GenerationPhase::ROOM_TILES:
+            // One room per step (lazy levels generate rooms on demand instead)
+            if (!Constants::LAZY_ROOM_GENERATION) {
+                while (tileCursor < GRID_WIDTH * GRID_HEIGHT) {
+                    int x = tileCursor % GRID_WIDTH;
+                    int y = tileCursor / GRID_WIDTH;
+                    tileCursor++;
+                    if (roomExists(x, y)) {
+                        generateRoomTiles(x, y);
+                        return false;
+                    }
+                }
+            }
+            
+            // Set starting position (generates the start room)
+            setCurrentRoom(startGridX, startGridY);
+            generationPhase = GenerationPhase::DONE;
+            
+            TYRA_LOG("Level ", levelNumber, ": Generation complete (", roomCount, " rooms, ",
+                     generatedRoomCount, " generated)");
+            printDebugMap();
+            return true;
+            
+        case GenerationPhase::DONE:
+            return true;
+    }
+    return true;
+}
+
+bool Level::releaseStep() {
+    // One grid row of rooms per step
+    if (releasedRows < static_cast<int>(grid.size())) {
+        for (Room& room : grid[releasedRows]) {
+            room.releaseTiles();
+        }
+        releasedRows++;
+        return releasedRows >= static_cast<int>(grid.size());
+    }
+    return true;
 }
 
 void Level::initializeGrid() {
     grid.clear();
     grid.resize(GRID_HEIGHT, std::vector<Room>(GRID_WIDTH));
+    roomPlans.assign(GRID_HEIGHT, std::vector<RoomPlan>(GRID_WIDTH, RoomPlan{0, 0}));
     roomQueue.clear();
     roomCount = 0;
+    generatedRoomCount = 0;
 }
 
-void Level::generateRoomLayout() {
-    // Direction vectors: Left, Right, Up, Down
-    const int directions[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
-    
+void Level::placeStartRoom() {
     // Place start room in center - just mark it as existing, don't generate tiles yet
     grid[startGridY][startGridX].setType(RoomType::START);
     grid[startGridY][startGridX].markExists();  // New method - just marks room as part of layout
@@ -83,77 +136,80 @@ void Level::generateRoomLayout() {
     roomCount = 1;
     
     TYRA_LOG("Placed start room at (", startGridX, ", ", startGridY, ")");
+}
+
+void Level::expandLayout() {
+    // Direction vectors: Left, Right, Up, Down
+    const int directions[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    
+    // One pass of BFS-style expansion
+    layoutIterations++;
+    std::vector<Tyra::Vec2> newRooms;
     
-    // BFS-style expansion
-    int iterations = 0;
-    while (roomCount < targetRoomCount && !roomQueue.empty() && iterations < 100) {
-        iterations++;
-        std::vector<Tyra::Vec2> newRooms;
+    // Shuffle the queue for more organic generation
+    rng.shuffle(roomQueue);
+    
+    for (const auto& roomPos : roomQueue) {
+        int x = static_cast<int>(roomPos.x);
+        int y = static_cast<int>(roomPos.y);
         
-        // Shuffle the queue for more organic generation
-        std::shuffle(roomQueue.begin(), roomQueue.end(), rng);
+        // Try each direction
+        std::vector<int> dirOrder = {0, 1, 2, 3};
+        rng.shuffle(dirOrder);
         
-        for (const auto& roomPos : roomQueue) {
-            int x = static_cast<int>(roomPos.x);
-            int y = static_cast<int>(roomPos.y);
+        for (int dirIdx : dirOrder) {
+            if (roomCount >= targetRoomCount) break;
             
-            // Try each direction
-            std::vector<int> dirOrder = {0, 1, 2, 3};
-            std::shuffle(dirOrder.begin(), dirOrder.end(), rng);
+            int newX = x + directions[dirIdx][0];
+            int newY = y + directions[dirIdx][1];
+            int fromDirX = -directions[dirIdx][0];
+            int fromDirY = -directions[dirIdx][1];
             
-            for (int dirIdx : dirOrder) {
-                if (roomCount >= targetRoomCount) break;
-                
-                int newX = x + directions[dirIdx][0];
-                int newY = y + directions[dirIdx][1];
-                int fromDirX = -directions[dirIdx][0];
-                int fromDirY = -directions[dirIdx][1];
-                
-                // Check if we can place a room here
-                if (!canPlaceRoom(newX, newY, fromDirX, fromDirY)) {
-                    continue;
-                }
-                
-                // Random chance to skip (creates more interesting layouts)
-                std::uniform_real_distribution<float> chanceDist(0.0f, 1.0f);
-                if (chanceDist(rng) < 0.3f) {  // Reduced skip chance
-                    continue;
-                }
-                
-                // Create the new room
-                Room& newRoom = grid[newY][newX];
-                newRoom.setType(RoomType::NORMAL);
-                newRoom.markExists();
-                
-                // Create doors between rooms
-                grid[y][x].createDoor(directions[dirIdx][0], directions[dirIdx][1]);
-                newRoom.createDoor(fromDirX, fromDirY);
-                
-                newRooms.push_back(Tyra::Vec2(newX, newY));
-                roomCount++;
-                
-                TYRA_LOG("Placed room at (", newX, ", ", newY, ") from (", x, ", ", y, ")");
+            // Check if we can place a room here
+            if (!canPlaceRoom(newX, newY, fromDirX, fromDirY)) {
+                continue;
             }
+            
+            // Random chance to skip (creates more interesting layouts)
+            if (rng.nextFloat() < 0.3f) {  // Reduced skip chance
+                continue;
+            }
+            
+            // Create the new room
+            Room& newRoom = grid[newY][newX];
+            newRoom.setType(RoomType::NORMAL);
+            newRoom.markExists();
+            
+            // Create doors between rooms
+            grid[y][x].createDoor(directions[dirIdx][0], directions[dirIdx][1]);
+            newRoom.createDoor(fromDirX, fromDirY);
+            
+            newRooms.push_back(Tyra::Vec2(newX, newY));
+            roomCount++;
+            
+            TYRA_LOG("Placed room at (", newX, ", ", newY, ") from (", x, ", ", y, ")");
         }
-        
-        // Add new rooms to queue for next iteration
-        for (const auto& newRoom : newRooms) {
-            roomQueue.push_back(newRoom);
-        }
-        
-        // Remove rooms that have been fully processed (surrounded or no valid expansion)
-        roomQueue.erase(
-            std::remove_if(roomQueue.begin(), roomQueue.end(), 
-                [this](const Tyra::Vec2& pos) {
-                    return countAdjacentRooms(static_cast<int>(pos.x), 
-                                              static_cast<int>(pos.y)) >= 3;
-                }),
-            roomQueue.end()
-        );
-        
-        TYRA_LOG("Iteration ", iterations, ": ", roomCount, " rooms, ", roomQueue.size(), " in queue");
     }
     
+    // Add new rooms to queue for next iteration
+    for (const auto& newRoom : newRooms) {
+        roomQueue.push_back(newRoom);
+    }
+    
+    // Remove rooms that have been fully processed (surrounded or no valid expansion)
+    roomQueue.erase(
+        std::remove_if(roomQueue.begin(), roomQueue.end(), 
+            [this](const Tyra::Vec2& pos) {
+                return countAdjacentRooms(static_cast<int>(pos.x), 
+                                          static_cast<int>(pos.y)) >= 3;
+            }),
+        roomQueue.end()
+    );
+    
+    TYRA_LOG("Iteration ", layoutIterations, ": ", roomCount, " rooms, ", roomQueue.size(), " in queue");
+}
+
+void Level::markEndRooms() {
     // Mark dead-end rooms (only one connection) as potential end rooms
     for (int y = 0; y < GRID_HEIGHT; y++) {
         for (int x = 0; x < GRID_WIDTH; x++) {
@@ -224,21 +280,13 @@ void Level::assignSpecialRooms() {
     }
 }
 
-void Level::generateRoomTiles() {
-    std::uniform_int_distribution<int> widthDist(Constants::ROOM_MIN_WIDTH, 
-                                                  Constants::ROOM_MAX_WIDTH);
-    std::uniform_int_distribution<int> heightDist(Constants::ROOM_MIN_HEIGHT, 
-                                                   Constants::ROOM_MAX_HEIGHT);
-    
+void Level::planRoomSizes() {
     for (int y = 0; y < GRID_HEIGHT; y++) {
         for (int x = 0; x < GRID_WIDTH; x++) {
             if (!roomExists(x, y)) continue;
             
             Room& room = grid[y][x];
             
-            // Start room is already generated, skip it
-            if (room.isGenerated()) continue;
-            
             // Determine room size - all rooms must be at least screen size
             int width, height;
             
@@ -278,33 +326,58 @@ void Level::generateRoomTiles() {
                 default:
                     // Random size for normal rooms
                     // Make one dimension standard and vary the other
-                    if (rng() % 2 == 0) {
-                        width = widthDist(rng);
+                    if (rng.nextInt(2) == 0) {
+                        width = rng.nextInt(Constants::ROOM_MIN_WIDTH, Constants::ROOM_MAX_WIDTH);
                         height = Constants::ROOM_MIN_HEIGHT;
                     } else {
                         width = Constants::ROOM_MIN_WIDTH;
-                        height = heightDist(rng);
+                        height = rng.nextInt(Constants::ROOM_MIN_HEIGHT, Constants::ROOM_MAX_HEIGHT);
                     }
                     break;
             }
             
             // Ensure even dimensions for door placement
-            width = (width / 2) * 2;
-            height = (height / 2) * 2;
-            
-            room.generate(&roomGenerator, width, height);
-            
-            // Generate side doors for Nanny boss room (barge spawn points)
-            if (room.getType() == RoomType::BOSS && levelNumber == 3) {
-                // Generate 3 doors per side (doors are 6 tiles tall and need spacing)
-                roomGenerator.generateNannySideDoors(&room, 3);
-                TYRA_LOG("Generated side doors for Nanny boss room");
-            }
+            roomPlans[y][x].width = (width / 2) * 2;
+            roomPlans[y][x].height = (height / 2) * 2;
         }
     }
+}
+
+void Level::generateRoomTiles(int x, int y) {
+    Room& room = grid[y][x];
+    if (room.isGenerated()) return;
+    
+    room.generate(&roomGenerator, roomPlans[y][x].width, roomPlans[y][x].height);
+    generatedRoomCount++;
+    
+    // Generate side doors for Nanny boss room (barge spawn points)
+    if (room.getType() == RoomType::BOSS && levelNumber == 3) {
+        // Generate 3 doors per side (doors are 6 tiles tall and need spacing)
+        roomGenerator.generateNannySideDoors(&room, 3);
+        TYRA_LOG("Generated side doors for Nanny boss room");
+    }
     
     // Place danger signs in the room leading to the boss room
-    placeBossRoomDangerSigns();
+    if (x == approachGridX && y == approachGridY) {
+        placeBossRoomDangerSigns();
+    }
+}
+
+int Level::generateNeighbourRooms(int maxRooms) {
+    const int directions[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    
+    int generatedNow = 0;
+    for (const auto& dir : directions) {
+        if (generatedNow >= maxRooms) break;
+        
+        int x = currentGridX + dir[0];
+        int y = currentGridY + dir[1];
+        if (roomExists(x, y) && !grid[y][x].isGenerated()) {
+            generateRoomTiles(x, y);
+            generatedNow++;
+        }
+    }
+    return generatedNow;
 }
 
 bool Level::isValidGridPosition(int x, int y) const {
@@ -365,6 +438,7 @@ float Level::distanceFromStart(int x, int y) const {
 Room* Level::getRoom(int gridX, int gridY) {
     if (!isValidGridPosition(gridX, gridY)) return nullptr;
     if (!grid[gridY][gridX].exists()) return nullptr;
+    generateRoomTiles(gridX, gridY);
     return &grid[gridY][gridX];
 }
 
@@ -381,8 +455,8 @@ Room* Level::getStartRoom() {
 Room* Level::getBossRoom() {
     for (int y = 0; y < GRID_HEIGHT; y++) {
         for (int x = 0; x < GRID_WIDTH; x++) {
-            if (grid[y][x].isGenerated() && grid[y][x].getType() == RoomType::BOSS) {
-                return &grid[y][x];
+            if (grid[y][x].exists() && grid[y][x].getType() == RoomType::BOSS) {
+                return getRoom(x, y);
             }
         }
     }
@@ -392,7 +466,7 @@ Room* Level::getBossRoom() {
 void Level::getBossRoomGridPos(int& outX, int& outY) {
     for (int y = 0; y < GRID_HEIGHT; y++) {
         for (int x = 0; x < GRID_WIDTH; x++) {
-            if (grid[y][x].isGenerated() && grid[y][x].getType() == RoomType::BOSS) {
+            if (grid[y][x].exists() && grid[y][x].getType() == RoomType::BOSS) {
                 outX = x;
                 outY = y;
                 return;
@@ -416,6 +490,65 @@ bool Level::canMoveToRoom(int gridX, int gridY) const {
     return roomExists(gridX, gridY);
 }
 
+bool Level::tryExitRoom(Tyra::Vec2& playerPosition) {
+    Room* room = currentRoom;
+    if (!room) return false;
+    
+    int gridX = currentGridX;
+    int gridY = currentGridY;
+    
+    // Left exit
+    if (playerPosition.x < 0.0f) {
+        Room* nextRoom = getRoom(gridX - 1, gridY);
+        if (nextRoom && nextRoom->exists()) {
+            setCurrentRoom(gridX - 1, gridY);
+            playerPosition.x = nextRoom->getWidth() - 2.0f;
+            playerPosition.y = nextRoom->getHeight() / 2.0f - 0.5f;
+            TYRA_LOG("Moved to room (", gridX - 1, ", ", gridY, ")");
+            return true;
+        }
+        playerPosition.x = 0.0f;
+    }
+    // Right exit
+    else if (playerPosition.x > room->getWidth() - 1.0f) {
+        Room* nextRoom = getRoom(gridX + 1, gridY);
+        if (nextRoom && nextRoom->exists()) {
+            setCurrentRoom(gridX + 1, gridY);
+            playerPosition.x = 1.0f;
+            playerPosition.y = nextRoom->getHeight() / 2.0f - 0.5f;
+            TYRA_LOG("Moved to room (", gridX + 1, ", ", gridY, ")");
+            return true;
+        }
+        playerPosition.x = room->getWidth() - 1.0f;
+    }
+    // Top exit
+    else if (playerPosition.y < 0.0f) {
+        Room* nextRoom = getRoom(gridX, gridY - 1);
+        if (nextRoom && nextRoom->exists()) {
+            setCurrentRoom(gridX, gridY - 1);
+            playerPosition.x = nextRoom->getWidth() / 2.0f - 0.5f;
+            playerPosition.y = nextRoom->getHeight() - 2.0f;
+            TYRA_LOG("Moved to room (", gridX, ", ", gridY - 1, ")");
+            return true;
+        }
+        playerPosition.y = 0.0f;
+    }
+    // Bottom exit
+    else if (playerPosition.y > room->getHeight() - 1.0f) {
+        Room* nextRoom = getRoom(gridX, gridY + 1);
+        if (nextRoom && nextRoom->exists()) {
+            setCurrentRoom(gridX, gridY + 1);
+            playerPosition.x = nextRoom->getWidth() / 2.0f - 0.5f;
+            playerPosition.y = 1.0f;
+            TYRA_LOG("Moved to room (", gridX, ", ", gridY + 1, ")");
+            return true;
+        }
+        playerPosition.y = room->getHeight() - 1.0f;
+    }
+    
+    return false;
+}
+
 void Level::printDebugMap() const {
     TYRA_LOG("=== Level ", levelNumber, " Map ===");
     
@@ -441,12 +574,12 @@ void Level::printDebugMap() const {
     TYRA_LOG("===================");
 }
 
-void Level::placeBossRoomDangerSigns() {
+void Level::findBossApproach() {
     // Find the boss room grid position
     int bossX = -1, bossY = -1;
     for (int y = 0; y < GRID_HEIGHT; y++) {
         for (int x = 0; x < GRID_WIDTH; x++) {
-            if (grid[y][x].isGenerated() && grid[y][x].getType() == RoomType::BOSS) {
+            if (grid[y][x].exists() && grid[y][x].getType() == RoomType::BOSS) {
                 bossX = x;
                 bossY = y;
                 break;
@@ -470,7 +603,7 @@ void Level::placeBossRoomDangerSigns() {
         
         if (!roomExists(adjX, adjY)) continue;
         
-        Room& adjRoom = grid[adjY][adjX];
+        const Room& adjRoom = grid[adjY][adjX];
         
         // Check if this room has a door leading to the boss room
         // The door direction from adjRoom's perspective is opposite
@@ -481,9 +614,9 @@ void Level::placeBossRoomDangerSigns() {
         else if (dir == 3 && adjRoom.hasTopDoor()) doorDir = 2;    // Boss is down, adj has top door
         
         if (doorDir >= 0) {
-            // Place danger signs in this room next to the door leading to boss
-            roomGenerator.placeDangerSigns(&adjRoom, doorDir);
-            TYRA_LOG("Placed danger signs in room (", adjX, ", ", adjY, ") direction ", doorDir);
+            approachGridX = adjX;
+            approachGridY = adjY;
+            approachDoorDir = doorDir;
             return;  // Only one room connects to boss (it's a dead end)
         }
     }
@@ -491,4 +624,10 @@ void Level::placeBossRoomDangerSigns() {
     TYRA_LOG("Warning: No adjacent room found connecting to boss room");
 }
 
+void Level::placeBossRoomDangerSigns() {
+    // Place danger signs in this room next to the door leading to boss
+    roomGenerator.placeDangerSigns(&grid[approachGridY][approachGridX], approachDoorDir);
+    TYRA_LOG("Placed danger signs in room (", approachGridX, ", ", approachGridY, ") direction ", approachDoorDir);
+}
+
 }  // namespace CanalUx
\ No newline at end of file
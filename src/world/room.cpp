@@ -4,10 +4,14 @@
 
 #include "world/room.hpp"
 #include "world/room_generator.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace CanalUx {
 
+const RoomCell Room::emptyCell;
+uint32_t Room::lastRevision = 0;
+
 Room::Room()
     : width(0),
       height(0),
@@ -23,13 +27,19 @@ Room::Room()
       roomExists(false),
       generated(false),
       cleared(false),
-      visited(false) {
+      visited(false),
+      generator(nullptr),
+      leftBarrier(-1),
+      rightBarrier(-1),
+      revision(0) {
+    touch();
 }
 
 Room::~Room() {
 }
 
-void Room::generate(RoomGenerator* generator, int w, int h) {
+void Room::generate(RoomGenerator* t_generator, int w, int h) {
+    generator = t_generator;
     width = w;
     height = h;
     
@@ -41,23 +51,32 @@ void Room::generate(RoomGenerator* generator, int w, int h) {
         cleared = true;
     }
     
-    // Generate tile maps using the generator
+    // Share the generator's tile map for this shape (empty map without one).
+    // Templates come with their collision mask - later edits keep it up to date.
     if (generator) {
-        waterMap = generator->generateWater(width, height, 
-                                            openLeft, openRight, openTop, openBottom);
-        landMap = generator->generateLand(width, height,
-                                          openLeft, openRight, openTop, openBottom);
-        sceneryMap = generator->generateScenery(width, height,
-                                                openLeft, openRight, openTop, openBottom,
-                                                cleared);
+        sharedCells = generator->getTemplate(width, height, openLeft, openRight, openTop, openBottom, cleared);
+        ownCells.clear();
     } else {
-        // Fallback: create empty maps
-        landMap.resize(height, std::vector<int>(width, 0));
-        waterMap.resize(height, std::vector<int>(width, 0));
-        sceneryMap.resize(height, std::vector<int>(width, 0));
+        sharedCells.reset();
+        ownCells.assign(width * height, RoomCell());
     }
     
     generated = true;
+    touch();
+}
+
+void Room::releaseTiles() {
+    // Swap with empties so the memory is actually returned
+    sharedCells.reset();
+    std::vector<RoomCell>().swap(ownCells);
+    std::vector<RoomObstacle>().swap(obstacles);
+    std::vector<int>().swap(obstacleHeads);
+    std::vector<ObstacleLink>().swap(obstacleLinks);
+    leftBarrier = -1;
+    rightBarrier = -1;
+    std::vector<SideDoor>().swap(sideDoors);
+    generated = false;
+    touch();
 }
 
 void Room::createDoor(int directionX, int directionY) {
@@ -71,66 +90,113 @@ void Room::completeClear() {
     if (cleared) return;
     
     cleared = true;
+    touch();
+    
+    // Unedited rooms just switch to the cleared template
+    if (sharedCells && generator) {
+        sharedCells = generator->getTemplate(width, height, openLeft, openRight, openTop, openBottom, true);
+        return;
+    }
     
     // Open doors by removing scenery tiles that block them
     int midWidth = width / 2;
     int midHeight = height / 2;
     
     if (openLeft) {
-        sceneryMap[midHeight - 1][1] = 0;
-        sceneryMap[midHeight][1] = 0;
+        setSceneryTile(1, midHeight - 1, 0);
+        setSceneryTile(1, midHeight, 0);
     }
     if (openRight) {
-        sceneryMap[midHeight - 1][width - 2] = 0;
-        sceneryMap[midHeight][width - 2] = 0;
+        setSceneryTile(width - 2, midHeight - 1, 0);
+        setSceneryTile(width - 2, midHeight, 0);
     }
     if (openTop) {
-        sceneryMap[1][midWidth - 1] = 0;
-        sceneryMap[1][midWidth] = 0;
+        setSceneryTile(midWidth - 1, 1, 0);
+        setSceneryTile(midWidth, 1, 0);
     }
     if (openBottom) {
-        sceneryMap[height - 2][midWidth - 1] = 0;
-        sceneryMap[height - 2][midWidth] = 0;
+        setSceneryTile(midWidth - 1, height - 2, 0);
+        setSceneryTile(midWidth, height - 2, 0);
     }
 }
 
-int Room::getLandTile(int x, int y) const {
-    if (y >= 0 && y < height && x >= 0 && x < width) {
-        return landMap[y][x];
+void Room::setSceneryTile(int x, int y, int tileId) {
+    if (isInBounds(x, y)) {
+        editCell(x, y).scenery = static_cast<uint8_t>(tileId);
+        updateCollision(x, y);
     }
-    return 0;  // Out of bounds = empty
 }
 
-int Room::getWaterTile(int x, int y) const {
-    if (y >= 0 && y < height && x >= 0 && x < width) {
-        return waterMap[y][x];
+void Room::setLandTile(int x, int y, int tileId) {
+    if (isInBounds(x, y)) {
+        editCell(x, y).land = static_cast<uint8_t>(tileId);
+        updateCollision(x, y);
     }
-    return 0;
 }
 
-int Room::getSceneryTile(int x, int y) const {
-    if (y >= 0 && y < height && x >= 0 && x < width) {
-        return sceneryMap[y][x];
+void Room::setWaterTile(int x, int y, int tileId) {
+    if (isInBounds(x, y)) {
+        editCell(x, y).water = static_cast<uint8_t>(tileId);
+        updateCollision(x, y);
     }
-    return 0;
 }
 
-void Room::setSceneryTile(int x, int y, int tileId) {
-    if (y >= 0 && y < height && x >= 0 && x < width) {
-        sceneryMap[y][x] = tileId;
+RoomCell& Room::editCell(int x, int y) {
+    touch();
+    if (sharedCells) {
+        ownCells = *sharedCells;
+        sharedCells.reset();
     }
+    return ownCells[y * width + x];
 }
 
-void Room::setLandTile(int x, int y, int tileId) {
-    if (y >= 0 && y < height && x >= 0 && x < width) {
-        landMap[y][x] = tileId;
+void Room::updateCollision(int x, int y) {
+    RoomCell& cell = editCell(x, y);
+    bool gateCell = isGateCell(x, y, width, height, openLeft, openRight, openTop, openBottom);
+    cell.collision = collisionFlagsFor(cell, gateCell);
+}
+
+void Room::buildCollisionMask(std::vector<RoomCell>& cells, int width, int height,
+                              bool doorLeft, bool doorRight, bool doorTop, bool doorBottom) {
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            RoomCell& cell = cells[y * width + x];
+            bool gateCell = isGateCell(x, y, width, height, doorLeft, doorRight, doorTop, doorBottom);
+            cell.collision = collisionFlagsFor(cell, gateCell);
+        }
     }
 }
 
-void Room::setWaterTile(int x, int y, int tileId) {
-    if (y >= 0 && y < height && x >= 0 && x < width) {
-        waterMap[y][x] = tileId;
+uint8_t Room::collisionFlagsFor(const RoomCell& cell, bool gateCell) {
+    uint8_t flags = 0;
+    if (cell.land != 0 || cell.scenery != 0) {
+        flags |= CollisionFlags::SOLID;
+    }
+    if (cell.land == 0 && cell.scenery != 0) {
+        flags |= CollisionFlags::SUBMERGED_PASSABLE;
     }
+    if (cell.water != 0) {
+        flags |= CollisionFlags::WATER;
+    }
+    if (cell.scenery != 0 && gateCell) {
+        flags |= CollisionFlags::GATE;
+    }
+    return flags;
+}
+
+bool Room::isGateCell(int x, int y, int width, int height,
+                      bool doorLeft, bool doorRight, bool doorTop, bool doorBottom) {
+    // Lock gates sit in the two door cells just inside each open wall
+    // (the same cells completeClear() opens)
+    int midWidth = width / 2;
+    int midHeight = height / 2;
+    bool doorRow = (y == midHeight - 1 || y == midHeight);
+    bool doorColumn = (x == midWidth - 1 || x == midWidth);
+    
+    return (doorLeft && x == 1 && doorRow) ||
+           (doorRight && x == width - 2 && doorRow) ||
+           (doorTop && y == 1 && doorColumn) ||
+           (doorBottom && y == height - 2 && doorColumn);
 }
 
 void Room::addSideDoor(float yPosition, bool isLeftSide) {
@@ -138,15 +204,48 @@ void Room::addSideDoor(float yPosition, bool isLeftSide) {
 }
 
 void Room::addObstacle(const RoomObstacle& obstacle) {
+    int index = static_cast<int>(obstacles.size());
     obstacles.push_back(obstacle);
+    linkObstacle(index, obstacle.position.x, obstacle.position.y, obstacle.size.x, obstacle.size.y);
+}
+
+void Room::linkObstacle(int index, float x, float y, float w, float h) {
+    touch();
+    if (width <= 0 || height <= 0) return;
+    if (obstacleHeads.empty()) {
+        obstacleHeads.assign(width * height, -1);
+    }
+    
+    // Link the obstacle into every tile the area touches. A tile linked
+    // twice (a grown barrier's old edge) is harmless - lookups keep the
+    // lowest index anyway.
+    int minX, minY, maxX, maxY;
+    getTileSpan(x, y, w, h, minX, minY, maxX, maxY);
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            int& head = obstacleHeads[y * width + x];
+            obstacleLinks.push_back({index, head});
+            head = static_cast<int>(obstacleLinks.size()) - 1;
+        }
+    }
 }
 
 void Room::clearObstacles() {
     obstacles.clear();
+    obstacleLinks.clear();
+    leftBarrier = -1;
+    rightBarrier = -1;
+    std::fill(obstacleHeads.begin(), obstacleHeads.end(), -1);
+    touch();
 }
 
 bool Room::hasObstacleAt(float x, float y) const {
-    for (const auto& obs : obstacles) {
+    if (obstacleHeads.empty()) return false;
+    
+    int minX, minY, maxX, maxY;
+    getTileSpan(x, y, 0.0f, 0.0f, minX, minY, maxX, maxY);
+    for (int link = obstacleHeads[minY * width + minX]; link >= 0; link = obstacleLinks[link].next) {
+        const RoomObstacle& obs = obstacles[obstacleLinks[link].obstacle];
         if (obs.blocksPlayer) {
             // Check if position is within obstacle bounds
             float dx = x - obs.position.x;
@@ -159,6 +258,114 @@ bool Room::hasObstacleAt(float x, float y) const {
     return false;
 }
 
+const RoomObstacle* Room::findObstacle(const Tyra::Vec2& position, const Tyra::Vec2& size,
+                                       uint8_t blocks) const {
+    if (obstacleHeads.empty()) return nullptr;
+    
+    // An obstacle can be linked from several tiles, and the caller wants the
+    // earliest placed one (as a scan of the whole list would find), so keep
+    // the lowest index that hits
+    int best = -1;
+    int minX, minY, maxX, maxY;
+    getTileSpan(position.x, position.y, size.x, size.y, minX, minY, maxX, maxY);
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            for (int link = obstacleHeads[y * width + x]; link >= 0; link = obstacleLinks[link].next) {
+                int index = obstacleLinks[link].obstacle;
+                if (best >= 0 && index >= best) continue;
+                
+                const RoomObstacle& obs = obstacles[index];
+                if ((obs.getBlocks() & blocks) &&
+                    position.x < obs.position.x + obs.size.x &&
+                    position.x + size.x > obs.position.x &&
+                    position.y < obs.position.y + obs.size.y &&
+                    position.y + size.y > obs.position.y) {
+                    best = index;
+                }
+            }
+        }
+    }
+    return best >= 0 ? &obstacles[best] : nullptr;
+}
+
+bool Room::hasLineOfSight(const Tyra::Vec2& from, const Tyra::Vec2& to, uint8_t blocks) const {
+    int x = static_cast<int>(std::floor(from.x));
+    int y = static_cast<int>(std::floor(from.y));
+    int endX = static_cast<int>(std::floor(to.x));
+    int endY = static_cast<int>(std::floor(to.y));
+    
+    // Step one tile at a time along whichever axis reaches its next tile
+    // edge first (t runs 0..1 from 'from' to 'to')
+    float dx = to.x - from.x;
+    float dy = to.y - from.y;
+    int stepX = dx > 0 ? 1 : -1;
+    int stepY = dy > 0 ? 1 : -1;
+    float tDeltaX = dx != 0 ? std::fabs(1.0f / dx) : INFINITY;
+    float tDeltaY = dy != 0 ? std::fabs(1.0f / dy) : INFINITY;
+    float tMaxX = dx != 0 ? ((dx > 0 ? x + 1 : x) - from.x) / dx : INFINITY;
+    float tMaxY = dy != 0 ? ((dy > 0 ? y + 1 : y) - from.y) / dy : INFINITY;
+    
+    // The line crosses exactly this many tiles - counting them keeps float
+    // error at the end from walking past the target tile
+    int tiles = 1 + std::abs(endX - x) + std::abs(endY - y);
+    for (int i = 0; i < tiles; i++) {
+        if (isInBounds(x, y)) {
+            if (cellAt(x, y).collision & CollisionFlags::SOLID) return false;
+            if (!obstacleHeads.empty() && segmentHitsObstacle(x, y, from, to, blocks)) return false;
+        }
+        
+        if (tMaxX < tMaxY) {
+            x += stepX;
+            tMaxX += tDeltaX;
+        } else {
+            y += stepY;
+            tMaxY += tDeltaY;
+        }
+    }
+    return true;
+}
+
+bool Room::segmentHitsObstacle(int x, int y, const Tyra::Vec2& from, const Tyra::Vec2& to,
+                               uint8_t blocks) const {
+    float dx = to.x - from.x;
+    float dy = to.y - from.y;
+    for (int link = obstacleHeads[y * width + x]; link >= 0; link = obstacleLinks[link].next) {
+        const RoomObstacle& obs = obstacles[obstacleLinks[link].obstacle];
+        if (!(obs.getBlocks() & blocks)) continue;
+        
+        // Clip the segment against the box one axis at a time
+        float tEnter = 0.0f;
+        float tExit = 1.0f;
+        const float start[2] = {from.x, from.y};
+        const float delta[2] = {dx, dy};
+        const float boxMin[2] = {obs.position.x, obs.position.y};
+        const float boxMax[2] = {obs.position.x + obs.size.x, obs.position.y + obs.size.y};
+        for (int axis = 0; axis < 2 && tEnter <= tExit; axis++) {
+            if (delta[axis] == 0) {
+                if (start[axis] <= boxMin[axis] || start[axis] >= boxMax[axis]) tEnter = 2.0f;
+                continue;
+            }
+            float t0 = (boxMin[axis] - start[axis]) / delta[axis];
+            float t1 = (boxMax[axis] - start[axis]) / delta[axis];
+            if (t0 > t1) std::swap(t0, t1);
+            tEnter = std::max(tEnter, t0);
+            tExit = std::min(tExit, t1);
+        }
+        if (tEnter < tExit) return true;
+    }
+    return false;
+}
+
+void Room::getTileSpan(float x, float y, float w, float h,
+                       int& minX, int& minY, int& maxX, int& maxY) const {
+    // Inclusive on both ends - an edge exactly on a tile boundary still
+    // lands in the next tile, which only costs an extra bucket visit
+    minX = std::max(0, std::min(width - 1, static_cast<int>(std::floor(x))));
+    minY = std::max(0, std::min(height - 1, static_cast<int>(std::floor(y))));
+    maxX = std::max(0, std::min(width - 1, static_cast<int>(std::floor(x + w))));
+    maxY = std::max(0, std::min(height - 1, static_cast<int>(std::floor(y + h))));
+}
+
 void Room::shrinkArena(float amount) {
     // Shrink from all sides
     arenaMinX += amount;
@@ -198,36 +405,45 @@ void Room::shrinkArenaHorizontal(float amount) {
         arenaMaxX = centerX + minWidth / 2.0f;
     }
     
-    // Add visual barrier obstacles at the new edges
-    // Left wall - add obstacles from old edge to new edge
-    for (float x = oldMinX; x < arenaMinX; x += 1.0f) {
-        for (float y = arenaMinY; y < arenaMaxY; y += 1.0f) {
-            RoomObstacle barrier;
-            barrier.position = Tyra::Vec2(x, y);
-            barrier.size = Tyra::Vec2(1.0f, 1.0f);
-            barrier.type = 1;  // Barrier type (different from trolley)
-            barrier.blocksPlayer = true;
-            barrier.blocksEnemies = false;
-            barrier.blocksPlayerShots = false;
-            barrier.blocksEnemyShots = false;
-            obstacles.push_back(barrier);
-        }
+    // Wall off the strips the arena gave up. Each side keeps a single
+    // barrier rectangle that grows with every shrink.
+    float bandHeight = std::ceil(arenaMaxY - arenaMinY);
+    if (arenaMinX > oldMinX) {
+        extendBarrier(leftBarrier, oldMinX, arenaMinY, std::ceil(arenaMinX - oldMinX), bandHeight);
     }
-    
-    // Right wall - add obstacles from new edge to old edge
-    for (float x = arenaMaxX; x < oldMaxX; x += 1.0f) {
-        for (float y = arenaMinY; y < arenaMaxY; y += 1.0f) {
-            RoomObstacle barrier;
-            barrier.position = Tyra::Vec2(x, y);
-            barrier.size = Tyra::Vec2(1.0f, 1.0f);
-            barrier.type = 1;  // Barrier type
-            barrier.blocksPlayer = true;
-            barrier.blocksEnemies = false;
-            barrier.blocksPlayerShots = false;
-            barrier.blocksEnemyShots = false;
-            obstacles.push_back(barrier);
+    if (oldMaxX > arenaMaxX) {
+        extendBarrier(rightBarrier, arenaMaxX, arenaMinY, std::ceil(oldMaxX - arenaMaxX), bandHeight);
+    }
+}
+
+void Room::extendBarrier(int& barrier, float x, float y, float w, float h) {
+    // Grow the existing rectangle when the new strip lines up with it
+    if (barrier >= 0) {
+        RoomObstacle& obs = obstacles[barrier];
+        bool sameRows = obs.position.y == y && obs.size.y == h;
+        if (sameRows && x == obs.position.x + obs.size.x) {
+            obs.size.x += w;
+            linkObstacle(barrier, x, y, w, h);
+            return;
+        }
+        if (sameRows && x + w == obs.position.x) {
+            obs.position.x = x;
+            obs.size.x += w;
+            linkObstacle(barrier, x, y, w, h);
+            return;
         }
     }
+    
+    RoomObstacle obstacle;
+    obstacle.position = Tyra::Vec2(x, y);
+    obstacle.size = Tyra::Vec2(w, h);
+    obstacle.type = 1;  // Barrier type (different from trolley)
+    obstacle.blocksPlayer = true;
+    obstacle.blocksEnemies = false;
+    obstacle.blocksPlayerShots = false;
+    obstacle.blocksEnemyShots = false;
+    barrier = static_cast<int>(obstacles.size());
+    addObstacle(obstacle);
 }
 
 void Room::resetArenaBounds() {